@@ -51,7 +51,11 @@ public:
     virtual void getParameterName(VstInt32 index, char *text);    // name of the parameter
     virtual void getParameterDisplay(VstInt32 index, char *text); // text description of the current value
     virtual VstInt32 canDo(char *text);
+
+    bool useReferenceConvolution = false; //adds the taps one at a time at full precision, as the per-console code did
 private:
+    void convolve(int console, double applyconvL, double applyconvR, long double &inputSampleL, long double &inputSampleR);
+
     char _programName[kVstMaxProgNameLen + 1];
     std::set< std::string > _canDo;
 
@@ -873,10 +873,10 @@ void Logical4::processReplacing(float **inputs, float **outputs, VstInt32 sample
 
         //stereo 32 bit dither, made small and tidy.
         int expon; frexpf((float)inputSampleL, &expon);
-        long double dither = (rand()/(RAND_MAX*7.737125245533627e+25))*pow(2,expon+62);
+        long double dither = (rand()/(RAND_MAX*7.737125245533627e+25))*ldexp(1.0,expon+62);
         inputSampleL += (dither-fpNShapeL); fpNShapeL = dither;
         frexpf((float)inputSampleR, &expon);
-        dither = (rand()/(RAND_MAX*7.737125245533627e+25))*pow(2,expon+62);
+        dither = (rand()/(RAND_MAX*7.737125245533627e+25))*ldexp(1.0,expon+62);
         inputSampleR += (dither-fpNShapeR); fpNShapeR = dither;
         //end 32 bit dither
 
@@ -1754,11 +1754,11 @@ void Logical4::processDoubleReplacing(double **inputs, double **outputs, VstInt3
 
         //stereo 64 bit dither, made small and tidy.
         int expon; frexp((double)inputSampleL, &expon);
-        long double dither = (rand()/(RAND_MAX*7.737125245533627e+25))*pow(2,expon+62);
+        long double dither = (rand()/(RAND_MAX*7.737125245533627e+25))*ldexp(1.0,expon+62);
         dither /= 536870912.0; //needs this to scale to 64 bit zone
         inputSampleL += (dither-fpNShapeL); fpNShapeL = dither;
         frexp((double)inputSampleR, &expon);
-        dither = (rand()/(RAND_MAX*7.737125245533627e+25))*pow(2,expon+62);
+        dither = (rand()/(RAND_MAX*7.737125245533627e+25))*ldexp(1.0,expon+62);
         dither /= 536870912.0; //needs this to scale to 64 bit zone
         inputSampleR += (dither-fpNShapeR); fpNShapeR = dither;
         //end 64 bit dither
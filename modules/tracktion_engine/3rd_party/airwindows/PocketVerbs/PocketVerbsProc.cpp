@@ -9169,10 +9169,10 @@ void PocketVerbs::processReplacing(float **inputs, float **outputs, VstInt32 sam
         //begin 32 bit stereo floating point dither
         int expon; frexpf((float)inputSampleL, &expon);
         fpd ^= fpd << 13; fpd ^= fpd >> 17; fpd ^= fpd << 5;
-        inputSampleL += ((double(fpd)-uint32_t(0x7fffffff)) * 5.5e-36l * pow(2,expon+62));
+        inputSampleL += ((double(fpd)-uint32_t(0x7fffffff)) * 5.5e-36l * ldexp(1.0,expon+62));
         frexpf((float)inputSampleR, &expon);
         fpd ^= fpd << 13; fpd ^= fpd >> 17; fpd ^= fpd << 5;
-        inputSampleR += ((double(fpd)-uint32_t(0x7fffffff)) * 5.5e-36l * pow(2,expon+62));
+        inputSampleR += ((double(fpd)-uint32_t(0x7fffffff)) * 5.5e-36l * ldexp(1.0,expon+62));
         //end 32 bit stereo floating point dither
 
         *out1 = inputSampleL;
@@ -18341,10 +18341,10 @@ void PocketVerbs::processDoubleReplacing(double **inputs, double **outputs, VstI
         //begin 64 bit stereo floating point dither
         int expon; frexp((double)inputSampleL, &expon);
         fpd ^= fpd << 13; fpd ^= fpd >> 17; fpd ^= fpd << 5;
-        inputSampleL += ((double(fpd)-uint32_t(0x7fffffff)) * 1.1e-44l * pow(2,expon+62));
+        inputSampleL += ((double(fpd)-uint32_t(0x7fffffff)) * 1.1e-44l * ldexp(1.0,expon+62));
         frexp((double)inputSampleR, &expon);
         fpd ^= fpd << 13; fpd ^= fpd >> 17; fpd ^= fpd << 5;
-        inputSampleR += ((double(fpd)-uint32_t(0x7fffffff)) * 1.1e-44l * pow(2,expon+62));
+        inputSampleR += ((double(fpd)-uint32_t(0x7fffffff)) * 1.1e-44l * ldexp(1.0,expon+62));
         //end 64 bit stereo floating point dither
 
         *out1 = inputSampleL;
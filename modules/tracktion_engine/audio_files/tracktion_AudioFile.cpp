@@ -161,6 +161,7 @@ AudioFileWriter::~AudioFileWriter()
 bool AudioFileWriter::isOpen() const noexcept               { const juce::ScopedLock sl (writerLock); return writer != nullptr; }
 double AudioFileWriter::getSampleRate() const noexcept      { jassert (isOpen()); const juce::ScopedLock sl (writerLock); return writer->getSampleRate(); }
 int AudioFileWriter::getNumChannels() const noexcept        { jassert (isOpen()); const juce::ScopedLock sl (writerLock); return writer->getNumChannels(); }
+int AudioFileWriter::getBitsPerSample() const noexcept      { jassert (isOpen()); const juce::ScopedLock sl (writerLock); return writer->getBitsPerSample(); }
 
 void AudioFileWriter::closeForWriting()
 {
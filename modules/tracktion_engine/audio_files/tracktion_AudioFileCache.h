@@ -54,6 +54,12 @@ public:
         int getNumChannels() const noexcept;
         double getSampleRate() const noexcept;
 
+        /** Returns false if the file couldn't be mapped by the cache, in which case this
+            reads through a juce::BufferingAudioReader instead. That can't tell whether
+            the data has been buffered yet, so shouldn't be used from the audio thread.
+        */
+        bool isReadingFromCache() const noexcept        { return file != nullptr; }
+
     private:
         friend class AudioFileCache;
 
@@ -42,6 +42,9 @@ public:
     /** Returns the num channels of the writer, should only be called on an open writer. */
     int getNumChannels() const noexcept;
 
+    /** Returns the bit depth of the writer, should only be called on an open writer. */
+    int getBitsPerSample() const noexcept;
+
     //==============================================================================
     /** Appends an AudioBuffer to the file. */
     bool appendBuffer (juce::AudioBuffer<float>& buffer, int numSamples);
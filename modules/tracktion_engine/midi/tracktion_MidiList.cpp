@@ -367,10 +367,9 @@ static void addToSequence (juce::MidiMessageSequence& seq, const MidiClip& clip,
     }
 }
 
-static void addToSequence (juce::MidiMessageSequence& seq, const MidiClip& clip,
-                           const MidiControllerEvent& controller, int channelNumber)
+static void addControllerMessages (juce::MidiMessageSequence& seq, const MidiClip& clip,
+                                   const MidiControllerEvent& controller, int channelNumber, double time)
 {
-    auto time = std::max (0.0, controller.getEditTime (clip) - clip.getPosition().getStart());
     auto type = controller.getType();
     auto value = controller.getControllerValue();
 
@@ -412,6 +411,13 @@ static void addToSequence (juce::MidiMessageSequence& seq, const MidiClip& clip,
     }
 }
 
+static void addToSequence (juce::MidiMessageSequence& seq, const MidiClip& clip,
+                           const MidiControllerEvent& controller, int channelNumber)
+{
+    addControllerMessages (seq, clip, controller, channelNumber,
+                           std::max (0.0, controller.getEditTime (clip) - clip.getPosition().getStart()));
+}
+
 static void addToSequence (juce::MidiMessageSequence& seq, const MidiClip& clip, const MidiSysexEvent& sysex)
 {
     auto time = std::max (0.0, sysex.getEditTime (clip) - clip.getPosition().getStart());
@@ -1125,6 +1131,81 @@ const juce::Array<MidiNote*>& MidiList::getNotes() const
     return getEventsChecked (noteList->getSortedList());
 }
 
+std::shared_ptr<const MidiList::NoteSnapshot> MidiList::getNoteSnapshot() const
+{
+    TRACKTION_ASSERT_MESSAGE_THREAD
+    jassert (noteList != nullptr);
+
+    auto& notes = getNotes();
+    auto current = noteSnapshot;
+
+    juce::Array<MidiNote*> changedNotes;
+    bool needsRebuilding;
+
+    {
+        const juce::ScopedLock sl (noteList->lock);
+        needsRebuilding = noteList->structureChangedSinceSnapshot || current == nullptr;
+        changedNotes.swapWith (noteList->changedSinceSnapshot);
+        noteList->structureChangedSinceSnapshot = false;
+    }
+
+    if (! needsRebuilding && changedNotes.isEmpty() && current->channel == getMidiChannel())
+        return current;
+
+    std::shared_ptr<NoteSnapshot> snapshot;
+
+    if (needsRebuilding)
+    {
+        snapshot = std::make_shared<NoteSnapshot>();
+        auto numNotes = (size_t) notes.size();
+
+        snapshot->startBeats.reserve (numNotes);
+        snapshot->lengthBeats.reserve (numNotes);
+        snapshot->noteNumbers.reserve (numNotes);
+        snapshot->velocities.reserve (numNotes);
+        snapshot->mutes.reserve (numNotes);
+        snapshot->notes.reserve (numNotes);
+
+        for (auto n : notes)
+        {
+            snapshot->startBeats.push_back (n->startBeat);
+            snapshot->lengthBeats.push_back (n->lengthInBeats);
+            snapshot->noteNumbers.push_back (n->noteNumber);
+            snapshot->velocities.push_back (n->velocity);
+            snapshot->mutes.push_back (n->mute);
+            snapshot->notes.push_back (n);
+        }
+    }
+    else
+    {
+        snapshot = std::make_shared<NoteSnapshot> (*current);
+
+        // These notes haven't moved, so they can be found by their start beat
+        for (auto n : changedNotes)
+        {
+            auto& starts = snapshot->startBeats;
+            auto i = (size_t) (std::lower_bound (starts.begin(), starts.end(), n->startBeat) - starts.begin());
+
+            for (; i < starts.size() && starts[i] == n->startBeat; ++i)
+            {
+                if (snapshot->notes[i] == n)
+                {
+                    snapshot->lengthBeats[i] = n->lengthInBeats;
+                    snapshot->noteNumbers[i] = n->noteNumber;
+                    snapshot->velocities[i] = n->velocity;
+                    snapshot->mutes[i] = n->mute;
+                    break;
+                }
+            }
+        }
+    }
+
+    snapshot->channel = getMidiChannel();
+    noteSnapshot = snapshot;
+
+    return snapshot;
+}
+
 const juce::Array<MidiControllerEvent*>& MidiList::getControllerEvents() const
 {
     jassert (controllerList != nullptr);
@@ -1785,8 +1866,6 @@ void MidiList::exportToPlaybackMidiSequence (juce::MidiMessageSequence& destSequ
     auto firstNoteTime = ts.timeToBeats (clip.getPosition().getStart()) - midiStartBeat - overlapAllowance;
     auto lastNoteTime  = ts.timeToBeats (clip.getPosition().getEnd())   - midiStartBeat + overlapAllowance;
 
-    auto& notes = getNotes();
-    auto numNotes = notes.size();
     auto selectedEvents = clip.getSelectedEvents();
 
     auto grooveTemplate = clip.edit.engine.getGrooveTemplateManager().getTemplateByName (clip.getGrooveTemplate());
@@ -1796,32 +1875,38 @@ void MidiList::exportToPlaybackMidiSequence (juce::MidiMessageSequence& destSequ
 
     if (! generateMPE)
     {
+        // The overlap checks scan ahead through the notes, so use the snapshot's arrays for them
+        auto snapshot = getNoteSnapshot();
+        auto& starts = snapshot->startBeats;
+        auto& lengths = snapshot->lengthBeats;
+        auto& noteNumbers = snapshot->noteNumbers;
+        auto numNotes = snapshot->size();
+
         for (int i = 0; i < numNotes; ++i)
         {
-            auto& note = *notes.getUnchecked (i);
+            auto& note = *snapshot->notes[(size_t) i];
 
             if (selectedEvents != nullptr && ! selectedEvents->isSelected (&note))
                 continue;
 
             // check for subsequent overlaps
-            auto thisNoteStart = note.getStartBeat();
+            auto thisNoteStart = starts[(size_t) i];
 
             if (thisNoteStart >= lastNoteTime)
                 break;
 
-            auto thisNoteEnd = note.getEndBeat();
-            auto noteNum = note.getNoteNumber();
+            auto thisNoteEnd = thisNoteStart + lengths[(size_t) i];
+            auto noteNum = noteNumbers[(size_t) i];
             bool useNoteUp = true;
 
             for (int j = i + 1; j < numNotes; ++j)
             {
-                const auto& note2 = *notes.getUnchecked (j);
-                const double s = note2.getStartBeat();
+                const double s = starts[(size_t) j];
 
                 if (s >= lastNoteTime || s >= thisNoteEnd)
                     break;
 
-                if (note2.getNoteNumber() == noteNum)
+                if (noteNumbers[(size_t) j] == noteNum)
                 {
                     useNoteUp = false;
                     break;
@@ -1836,7 +1921,7 @@ void MidiList::exportToPlaybackMidiSequence (juce::MidiMessageSequence& destSequ
     {
         MPEChannelAssigner assigner (destSequence, clip, grooveTemplate);
 
-        for (auto note : notes)
+        for (auto note : getNotes())
         {
             if (selectedEvents != nullptr && ! selectedEvents->isSelected (note))
                 continue;
@@ -1885,4 +1970,104 @@ void MidiList::exportToPlaybackMidiSequence (juce::MidiMessageSequence& destSequ
     }
 }
 
+void MidiList::exportLoopToPlaybackMidiSequence (juce::MidiMessageSequence& destSequence, MidiClip& clip) const
+{
+    auto& ts = clip.edit.tempoSequence;
+    auto& quantisation = clip.getQuantisation();
+    auto channelNumber = getMidiChannel().getChannelNumber();
+    auto selectedEvents = clip.getSelectedEvents();
+
+    const auto loopStart = clip.getLoopStartBeats();
+    const auto loopLength = clip.getLoopLengthBeats();
+    const auto contentStart = clip.getContentStartBeat();
+
+    auto grooveTemplate = clip.edit.engine.getGrooveTemplateManager().getTemplateByName (clip.getGrooveTemplate());
+
+    if (grooveTemplate != nullptr && grooveTemplate->isEmpty())
+        grooveTemplate = nullptr;
+
+    // Converts a beat in the loop range to a quantised and grooved beat in the first repetition
+    auto getPlaybackBeat = [&] (double quantisedBeatInEdit)
+    {
+        if (grooveTemplate != nullptr)
+            quantisedBeatInEdit = ts.timeToBeats (grooveTemplate->editTimeToGroovyTime (ts.beatsToTime (quantisedBeatInEdit),
+                                                                                        clip.getGrooveStrength(), clip.edit));
+
+        return juce::jlimit (0.0, loopLength, quantisedBeatInEdit - contentStart);
+    };
+
+    struct NoteToAdd
+    {
+        const MidiNote* note;
+        double start, end;
+    };
+
+    std::vector<NoteToAdd> notesToAdd;
+    auto snapshot = getNoteSnapshot();
+
+    for (int i = 0; i < snapshot->size(); ++i)
+    {
+        auto note = snapshot->notes[(size_t) i];
+
+        if (snapshot->mutes[(size_t) i] != 0 || (selectedEvents != nullptr && ! selectedEvents->isSelected (note)))
+            continue;
+
+        // trim the notes to the loop range, as the looped sequence does
+        auto noteStart = snapshot->startBeats[(size_t) i];
+        auto start = std::max (noteStart, loopStart) - loopStart;
+        auto end = std::min (noteStart + snapshot->lengthBeats[(size_t) i], loopStart + loopLength) - loopStart;
+
+        if (start >= loopLength || end - start <= 0.00001)
+            continue;
+
+        auto quantisedStart = quantisation.roundBeatToNearest (start + contentStart);
+        notesToAdd.push_back ({ note, getPlaybackBeat (quantisedStart), getPlaybackBeat (quantisedStart + end - start) });
+    }
+
+    std::stable_sort (notesToAdd.begin(), notesToAdd.end(),
+                      [] (const NoteToAdd& a, const NoteToAdd& b) { return a.start < b.start; });
+
+    for (auto i = notesToAdd.begin(); i != notesToAdd.end(); ++i)
+    {
+        if (i->start >= loopLength)
+            continue;
+
+        auto noteNumber = i->note->getNoteNumber();
+        destSequence.addEvent (juce::MidiMessage::noteOn (channelNumber, noteNumber, (juce::uint8) i->note->getVelocity()), i->start);
+
+        // leave out the note-up if the same note is played again before this one ends
+        bool useNoteUp = i->end > i->start;
+
+        for (auto j = i + 1; j != notesToAdd.end() && useNoteUp && j->start < i->end; ++j)
+            if (j->note->getNoteNumber() == noteNumber)
+                useNoteUp = false;
+
+        if (useNoteUp)
+            destSequence.addEvent (juce::MidiMessage::noteOff (channelNumber, noteNumber), i->end);
+    }
+
+    for (auto e : getControllerEvents())
+    {
+        auto beat = e->getBeatPosition() - loopStart;
+
+        if (beat >= 0.0 && beat < loopLength)
+            addControllerMessages (destSequence, clip, *e, channelNumber,
+                                   juce::jlimit (0.0, loopLength, quantisation.roundBeatToNearest (beat + contentStart) - contentStart));
+    }
+
+    for (auto e : getSysexEvents())
+    {
+        auto beat = e->getBeatPosition() - loopStart;
+
+        if (beat >= 0.0 && beat < loopLength)
+        {
+            auto m = e->getMessage();
+            m.setTimeStamp (juce::jlimit (0.0, loopLength, quantisation.roundBeatToNearest (beat + contentStart) - contentStart));
+            destSequence.addEvent (m);
+        }
+    }
+
+    destSequence.updateMatchedPairs();
+}
+
 }
@@ -127,9 +127,43 @@ public:
     void importFromEditTimeSequenceWithNoteExpression (const juce::MidiMessageSequence&, Edit*,
                                                        double editTimeOfListTimeZero, juce::UndoManager*);
 
+    //==============================================================================
+    /** An immutable copy of the notes' playback properties, sorted by start beat.
+        Each property is kept in its own array so they can be scanned without chasing
+        pointers to the MidiNote objects.
+    */
+    struct NoteSnapshot
+    {
+        std::vector<double> startBeats, lengthBeats;
+        std::vector<juce::uint8> noteNumbers, velocities, mutes;
+
+        /** The notes each entry came from. Only use these on the message thread. */
+        std::vector<MidiNote*> notes;
+
+        /** The channel the list's notes are played on. */
+        MidiChannel channel;
+
+        int size() const noexcept                                   { return (int) startBeats.size(); }
+    };
+
+    /** Returns a snapshot of the notes, bringing it up to date first if they've changed.
+        If only a few notes have changed without moving, the last snapshot is copied and
+        patched, otherwise it's rebuilt from the sorted list.
+        This must be called on the message thread.
+    */
+    std::shared_ptr<const NoteSnapshot> getNoteSnapshot() const;
+
     // Add equivalent events to the sequence, for playback
     void exportToPlaybackMidiSequence (juce::MidiMessageSequence&, MidiClip&, bool generateMPE) const;
 
+    /** Adds the events for a single repetition of a looped clip's loop range, for playback.
+        The timestamps are in beats from the start of the repetition, so the same sequence
+        can be played for every repetition whatever the tempo. Quantisation and groove are
+        applied as they would be for the first repetition.
+        @see LoopingMidiAudioNode
+    */
+    void exportLoopToPlaybackMidiSequence (juce::MidiMessageSequence&, MidiClip&) const;
+
     //==============================================================================
     static bool looksLikeMPEData (const juce::File&);
 
@@ -210,21 +244,31 @@ private:
         bool isSuitableType (const juce::ValueTree& v) const override   { return EventDelegate<EventType>::isSuitableType (v); }
         EventType* createNewObject (const juce::ValueTree& v) override  { return new EventType (v); }
         void deleteObject (EventType* m) override                       { delete m; }
-        void newObjectAdded (EventType*) override                       { triggerSort(); }
-        void objectRemoved (EventType* m) override                      { EventDelegate<EventType>::removeFromSelection (m); triggerSort(); }
+        void newObjectAdded (EventType* e) override                     { insertIntoSortedList (e); }
+        void objectRemoved (EventType* m) override                      { EventDelegate<EventType>::removeFromSelection (m); removeFromSortedList (m); }
         void objectOrderChanged() override                              { triggerSort(); }
 
         void valueTreePropertyChanged (juce::ValueTree& v, const juce::Identifier& i) override
         {
             if (auto e = getEventFor (v))
+            {
                 if (EventDelegate<EventType>::updateObject (*e, i))
-                    triggerSort();
+                {
+                    removeFromSortedList (e);
+                    insertIntoSortedList (e);
+                }
+                else
+                {
+                    eventChanged (e);
+                }
+            }
         }
 
         void triggerSort()
         {
             const juce::ScopedLock sl (lock);
             needsSorting = true;
+            structureChanged();
         }
 
         const juce::Array<EventType*>& getSortedList()
@@ -240,11 +284,71 @@ private:
                 sortMidiEventsByTime (sortedEvents);
             }
 
+            numIncrementalChanges = 0;
             return sortedEvents;
         }
 
-        bool needsSorting = true;
-        juce::Array<EventType*> sortedEvents;
+        //==============================================================================
+        // A few edits are applied to the sorted list in place, but after a lot of them
+        // (e.g. when notes are being added in bulk) it's quicker to sort it again
+        static constexpr int maxIncrementalChanges = 64;
+
+        void insertIntoSortedList (EventType* e)
+        {
+            const juce::ScopedLock sl (lock);
+            structureChanged();
+
+            if (needsSorting || ++numIncrementalChanges > maxIncrementalChanges)
+            {
+                needsSorting = true;
+                return;
+            }
+
+            auto pos = std::upper_bound (sortedEvents.begin(), sortedEvents.end(), e->getBeatPosition(),
+                                         [] (double beat, const EventType* other) { return beat < other->getBeatPosition(); });
+            sortedEvents.insert ((int) (pos - sortedEvents.begin()), e);
+        }
+
+        void removeFromSortedList (EventType* e)
+        {
+            const juce::ScopedLock sl (lock);
+            structureChanged();
+
+            if (needsSorting || ++numIncrementalChanges > maxIncrementalChanges)
+            {
+                needsSorting = true;
+                return;
+            }
+
+            sortedEvents.removeFirstMatchingValue (e);
+        }
+
+        //==============================================================================
+        // Changes since the last snapshot was made, so that it can be patched rather than rebuilt
+        static constexpr int maxChangesToPatch = 256;
+
+        void eventChanged (EventType* e)
+        {
+            const juce::ScopedLock sl (lock);
+
+            if (structureChangedSinceSnapshot)
+                return;
+
+            if (changedSinceSnapshot.size() >= maxChangesToPatch)
+                structureChanged();
+            else
+                changedSinceSnapshot.addIfNotAlreadyThere (e);
+        }
+
+        void structureChanged()
+        {
+            structureChangedSinceSnapshot = true;
+            changedSinceSnapshot.clearQuick();
+        }
+
+        bool needsSorting = true, structureChangedSinceSnapshot = true;
+        int numIncrementalChanges = 0;
+        juce::Array<EventType*> sortedEvents, changedSinceSnapshot;
         juce::CriticalSection lock;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EventList)
@@ -254,6 +358,8 @@ private:
     std::unique_ptr<EventList<MidiControllerEvent>> controllerList;
     std::unique_ptr<EventList<MidiSysexEvent>> sysexList;
 
+    mutable std::shared_ptr<const NoteSnapshot> noteSnapshot;
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MidiList)
 };
@@ -247,6 +247,20 @@ bool MidiClip::usesGrooveStrength() const
 AudioNode* MidiClip::createAudioNode (const CreateAudioNodeParams& params)
 {
     CRASH_TRACER
+
+    // Looped clips are played from a single repetition so they don't have to be flattened
+    if (isLooping() && ! mpeMode && getLoopLengthBeats() > 0.0)
+    {
+        MidiMessageSequence loopSequence;
+        getSequence().exportLoopToPlaybackMidiSequence (loopSequence, *this);
+
+        return new LoopingMidiAudioNode (std::move (loopSequence), getLoopLengthBeats(), getContentStartBeat(),
+                                         edit.tempoSequence.getTempoSections(),
+                                         Range<int>::withStartAndLength (getMidiChannel().getChannelNumber(), 0),
+                                         getEditTimeRange(), volumeDb, mute, *this,
+                                         getLoopingClipIfPresentInNode (params.audioNodeToBeReplaced, *this));
+    }
+
     MidiMessageSequence sequence;
     getSequenceLooped().exportToPlaybackMidiSequence (sequence, *this, mpeMode);
 
@@ -484,6 +484,8 @@ Edit::Edit (Options options)
       instanceId (getNextInstanceId()),
       editProjectItemID (options.editProjectItemID),
       loadContext (options.loadContext),
+      loadProfiler (options.loadProfiler),
+      numPluginLoadThreads (options.numPluginLoadThreads),
       editRole (options.role)
 {
     CRASH_TRACER
@@ -546,6 +548,8 @@ Edit::Edit (Options options)
         loadContext = nullptr;
     }
 
+    loadProfiler = nullptr;
+
     // Don't spam logs with preview Edits
     if (getProjectItemID().getProjectID() != 0)
         TRACKTION_LOG ("Loaded edit: " + getName());
@@ -662,6 +666,7 @@ void Edit::initialise()
 {
     CRASH_TRACER
     const StopwatchTimer loadTimer;
+    const EditLoadProfiler::ScopedEvent loadEvent (loadProfiler, EditLoadProfiler::phaseCategory, "Edit::initialise");
 
     if (loadContext != nullptr)
         loadContext->progress = 0.0f;
@@ -677,52 +682,71 @@ void Edit::initialise()
     lastSignificantChange.referTo (state, IDs::lastSignificantChange, nullptr,
                                    juce::String::toHexString (juce::Time::getCurrentTime().toMilliseconds()));
 
-    globalMacros = std::make_unique<GlobalMacros> (*this);
-    initialiseTempoAndPitch();
-    initialiseTransport();
-    initialiseVideo();
-    initialiseAutomap();
-    initialiseClickTrack();
-    initialiseMetadata();
-    initialiseMasterVolume();
-    initialiseRacks();
-    initialiseMasterPlugins();
-    initialiseAuxBusses();
-    initialiseAudioDevices();
-    loadTracks();
+    auto phase = [this] (const char* name, const std::function<void()>& f)
+    {
+        const EditLoadProfiler::ScopedEvent event (loadProfiler, EditLoadProfiler::phaseCategory, name);
+        f();
+    };
+
+    phase ("initialiseGlobalMacros",    [this] { globalMacros = std::make_unique<GlobalMacros> (*this); });
+    phase ("initialiseTempoAndPitch",   [this] { initialiseTempoAndPitch(); });
+    phase ("initialiseTransport",       [this] { initialiseTransport(); });
+    phase ("initialiseVideo",           [this] { initialiseVideo(); });
+    phase ("initialiseAutomap",         [this] { initialiseAutomap(); });
+    phase ("initialiseClickTrack",      [this] { initialiseClickTrack(); });
+    phase ("initialiseMetadata",        [this] { initialiseMetadata(); });
+    phase ("initialiseMasterVolume",    [this] { initialiseMasterVolume(); });
+    phase ("initialiseRacks",           [this] { initialiseRacks(); });
+    phase ("initialiseMasterPlugins",   [this] { initialiseMasterPlugins(); });
+    phase ("initialiseAuxBusses",       [this] { initialiseAuxBusses(); });
+    phase ("initialiseAudioDevices",    [this] { initialiseAudioDevices(); });
+
+    // ExternalPlugins created while the tracks are loaded will be handed back to
+    // initialiseDeferredPlugins() so they can be instantiated concurrently. The racks
+    // and master plugins are already fully initialised by this point.
+    // Waiting for them on the message thread would mean running the message loop while
+    // this Edit is only half built, so when loading there they're created serially.
+    isDeferringPluginInitialisation = numPluginLoadThreads > 1 && shouldLoadPlugins()
+                                        && ! juce::MessageManager::getInstance()->isThisTheMessageThread();
+
+    phase ("loadTracks",                [this] { loadTracks(); });
+    phase ("initialiseDeferredPlugins", [this] { initialiseDeferredPlugins(); });
 
     if (loadContext != nullptr)
         loadContext->progress = 1.0f;
 
-    initialiseTracks();
-    initialiseARA();
-    updateMuteSoloStatuses();
-    readFrozenTracksFiles();
+    phase ("initialiseTracks",          [this] { initialiseTracks(); });
+    phase ("initialiseARA",             [this] { initialiseARA(); });
+    phase ("updateMuteSoloStatuses",    [this] { updateMuteSoloStatuses(); });
+    phase ("readFrozenTracksFiles",     [this] { readFrozenTracksFiles(); });
 
     getLength(); // forcibly update the length before the isLoadInProgress is disabled.
 
     for (auto t : getAllTracks (*this))
         t->cancelAnyPendingUpdates();
 
-    initialiseControllerMappings();
-    TemporaryFileManager::purgeOrphanFreezeAndProxyFiles (*this);
+    phase ("initialiseControllerMappings", [this] { initialiseControllerMappings(); });
+    phase ("purgeOrphanFreezeAndProxyFiles", [this] { TemporaryFileManager::purgeOrphanFreezeAndProxyFiles (*this); });
 
-    callBlocking ([this]
-                  {
-                      // Must be set to false before curve updates
-                      // but set inside here to give the message loop some time to dispatch async updates
-                      isLoadInProgress = false;
+    phase ("initialiseParameters", [this]
+    {
+        callBlocking ([this]
+                      {
+                          // Must be set to false before curve updates
+                          // but set inside here to give the message loop some time to dispatch async updates
+                          isLoadInProgress = false;
 
-                      for (auto mpl : getAllMacroParameterLists (*this))
-                          for (auto mp : mpl->getMacroParameters())
-                              mp->initialise();
+                          for (auto mpl : getAllMacroParameterLists (*this))
+                              for (auto mp : mpl->getMacroParameters())
+                                  mp->initialise();
 
-                      for (auto ap : getAllAutomatableParams (true))
-                          ap->updateStream();
+                          for (auto ap : getAllAutomatableParams (true))
+                              ap->updateStream();
 
-                      for (auto effect : getAllClipEffects (*this))
-                          effect->initialise();
-                  });
+                          for (auto effect : getAllClipEffects (*this))
+                              effect->initialise();
+                      });
+    });
 
     cancelAnyPendingUpdates();
 
@@ -1219,6 +1243,12 @@ Track::Ptr Edit::loadTrackFrom (juce::ValueTree& v)
 template <typename Type>
 static Track::Ptr createAndInitialiseTrack (Edit& ed, const juce::ValueTree& v)
 {
+    const EditLoadProfiler::ScopedEvent event (ed.getLoadProfiler(), EditLoadProfiler::trackCategory,
+                                               [&v] (juce::String& name, juce::String& detail)
+                                               {
+                                                   name = v.getType().toString();
+                                                   detail = v[IDs::name].toString();
+                                               });
     Track::Ptr t = new Type (ed, v);
     t->initialise();
     return t;
@@ -2057,6 +2087,80 @@ void Edit::initialiseAllPlugins()
         p->initialiseFully();
 }
 
+bool Edit::deferPluginInitialisation (Plugin& p)
+{
+    if (! isDeferringPluginInitialisation)
+        return false;
+
+    pluginsAwaitingInitialisation.add (&p);
+    return true;
+}
+
+void Edit::initialiseDeferredPlugins()
+{
+    CRASH_TRACER
+    isDeferringPluginInitialisation = false;
+    auto plugins = std::move (pluginsAwaitingInitialisation);
+
+    if (plugins.isEmpty())
+        return;
+
+    const int numPlugins = plugins.size();
+    std::atomic<int> numDone { 0 };
+
+    auto updateProgress = [this, &numDone, numPlugins]
+    {
+        if (loadContext != nullptr)
+            loadContext->progress = 0.5f + 0.5f * (float) numDone.load() / (float) numPlugins;
+    };
+
+    if (loadContext != nullptr)
+        loadContext->progress = 0.5f;
+
+    // Plugins are only deferred when loading off the message thread, so this can block
+    jassert (! juce::MessageManager::getInstance()->isThisTheMessageThread());
+
+    {
+        // Plugins that can be created off the message thread are instantiated and have their
+        // state restored on the pool, the rest are done on this thread in the meantime
+        juce::ThreadPool pool (numPluginLoadThreads);
+        juce::WaitableEvent jobFinished;
+
+        for (auto p : plugins)
+        {
+            if (auto ep = dynamic_cast<ExternalPlugin*> (p))
+            {
+                if (ep->canInstantiateOnBackgroundThread())
+                {
+                    pool.addJob ([ep, &numDone, &jobFinished]
+                                 {
+                                     ep->instantiateOnBackgroundThread();
+                                     ++numDone;
+                                     jobFinished.signal();
+                                 });
+                    continue;
+                }
+            }
+
+            p->initialiseFully();
+            ++numDone;
+            updateProgress();
+        }
+
+        while (pool.getNumJobs() > 0)
+        {
+            updateProgress();
+            jobFinished.wait (5);
+        }
+    }
+
+    // Now finish off the ones that were created in the background
+    for (auto p : plugins)
+        p->initialiseFully();
+
+    updateProgress();
+}
+
 //==============================================================================
 InputDeviceInstance* Edit::getCurrentInstanceForInputDevice (InputDevice* d) const
 {
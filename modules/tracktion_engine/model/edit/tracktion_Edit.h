@@ -69,6 +69,8 @@ public:
 
         std::function<juce::File()> editFileRetriever;                      /**< An optional editFileRetriever to use. */
         std::function<juce::File (const juce::String&)> filePathResolver;   /**< An optional filePathResolver to use. */
+        int numPluginLoadThreads = 1;                                       /**< If greater than 1 and the Edit is loaded off the message thread, ExternalPlugins will be instantiated concurrently. @see EngineBehaviour::canInstantiatePluginOffMessageThread */
+        EditLoadProfiler* loadProfiler = nullptr;                           /**< An optional profiler to record the load timings to. This must outlive the Edit's constructor. */
     };
 
     /** Creates an Edit from a set of Options. */
@@ -137,6 +139,11 @@ public:
     /** Returns true if the Edit's not yet fully loaded */
     bool isLoading() const                                              { return isLoadInProgress; }
 
+    /** Returns the profiler the Edit is being loaded with, or nullptr if it isn't being
+        profiled or has finished loading.
+    */
+    EditLoadProfiler* getLoadProfiler() const noexcept                  { return loadProfiler; }
+
     static std::unique_ptr<Edit> createEditForPreviewingFile (Engine&, const juce::File&, const Edit* editToMatch,
                                                               bool tryToMatchTempo, bool tryToMatchPitch, bool* couldMatchTempo,
                                                               juce::ValueTree midiPreviewPlugin,
@@ -191,6 +198,13 @@ public:
     //==============================================================================
     void initialiseAllPlugins();
 
+    /** @internal
+        Called by ExternalPlugins as they're created. If the Edit is loading its plugins
+        concurrently this will take a reference to the plugin and return true, in which
+        case the plugin should leave its full initialisation to the Edit.
+    */
+    bool deferPluginInitialisation (Plugin&);
+
     //==============================================================================
     juce::String getSelectableDescription() override            { return TRANS("Edit") + " - \"" + getName() + "\""; }
 
@@ -533,6 +547,10 @@ private:
     bool hasChanged = false;
     bool ignoreLeftViewLimit;
     LoadContext* loadContext = nullptr;
+    EditLoadProfiler* loadProfiler = nullptr;
+    int numPluginLoadThreads = 1;
+    bool isDeferringPluginInitialisation = false;
+    juce::ReferenceCountedArray<Plugin> pluginsAwaitingInitialisation;
     juce::UndoManager undoManager;
     int numUndoTransactionInhibitors = 0;
     mutable juce::File tempDirectory;
@@ -554,11 +572,14 @@ private:
     struct ChangedPluginsList;
     std::unique_ptr<ChangedPluginsList> changedPluginsList;
 
+    std::unique_ptr<EditChunkCache> chunkCache;
+
     SharedLevelMeasurer::Ptr previewLevelMeasurer;
     juce::ListenerList<WastedMidiMessagesListener> wastedMidiMessagesListeners;
 
     //==============================================================================
     friend struct TrackList;
+    friend class EditFileOperations;
 
     Track::Ptr createTrack (const juce::ValueTree&);
     Track::Ptr loadTrackFrom (juce::ValueTree&);
@@ -586,6 +607,7 @@ private:
     void initialiseControllerMappings();
     void initialiseAutomap();
     void initialiseARA();
+    void initialiseDeferredPlugins();
     void removeZeroLengthClips();
     void loadTracks();
     void loadOldTimeSigInfo();
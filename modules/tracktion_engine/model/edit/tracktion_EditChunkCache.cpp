@@ -0,0 +1,184 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+/** Watches one of the Edit's top-level trees and throws away its encoded chunk
+    whenever anything inside it changes.
+*/
+struct EditChunkCache::Entry  : private juce::ValueTree::Listener
+{
+    Entry (const juce::ValueTree& v, juce::uint32 entryID, std::shared_ptr<Store> s)
+        : source (v), id (entryID), store (std::move (s))
+    {
+        source.addListener (this);
+    }
+
+    ~Entry() override
+    {
+        source.removeListener (this);
+    }
+
+    juce::ValueTree source;
+    const juce::uint32 id;
+
+private:
+    std::shared_ptr<Store> store;
+
+    void markDirty()
+    {
+        const juce::ScopedLock sl (store->lock);
+        auto& encoded = store->encoded[id];
+        encoded.chunk.reset();
+        ++encoded.generation;
+    }
+
+    void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override     { markDirty(); }
+    void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override                 { markDirty(); }
+    void valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int) override          { markDirty(); }
+    void valueTreeChildOrderChanged (juce::ValueTree&, int, int) override                  { markDirty(); }
+    void valueTreeParentChanged (juce::ValueTree&) override {}
+
+    JUCE_DECLARE_NON_COPYABLE (Entry)
+};
+
+//==============================================================================
+EditChunkCache::EditChunkCache (const juce::ValueTree& v)
+    : state (v)
+{
+}
+
+EditChunkCache::~EditChunkCache()
+{
+}
+
+std::function<bool()> EditChunkCache::createWriteJob (const juce::File& f)
+{
+    TRACKTION_ASSERT_MESSAGE_THREAD
+    CRASH_TRACER
+
+    // The root's own properties aren't tracked as they're quick to copy each time
+    juce::ValueTree root (state.getType());
+    root.copyPropertiesFrom (state, nullptr);
+
+    std::vector<PendingChunk> chunks;
+    chunks.reserve ((size_t) state.getNumChildren());
+
+    {
+        std::vector<std::unique_ptr<Entry>> newEntries;
+        newEntries.reserve ((size_t) state.getNumChildren());
+
+        // Group the existing entries by type and ID so that each child only has to be
+        // compared with the handful that could match, rather than all of them
+        auto getKey = [] (const juce::ValueTree& v)     { return v.getType().toString() + "/" + v[IDs::id].toString(); };
+        std::map<juce::String, std::vector<std::unique_ptr<Entry>>> existingEntries;
+
+        for (auto& e : entries)
+            existingEntries[getKey (e->source)].push_back (std::move (e));
+
+        const juce::ScopedLock sl (store->lock);
+
+        for (const auto& child : state)
+        {
+            std::unique_ptr<Entry> entry;
+            auto found = existingEntries.find (getKey (child));
+
+            if (found != existingEntries.end())
+            {
+                auto& candidates = found->second;
+
+                for (auto& e : candidates)
+                {
+                    if (e != nullptr && e->source == child)
+                    {
+                        entry = std::move (e);
+                        break;
+                    }
+                }
+            }
+
+            if (entry == nullptr)
+                entry = std::make_unique<Entry> (child, ++store->nextID, store);
+
+            auto& encoded = store->encoded[entry->id];
+
+            chunks.push_back ({ entry->id, encoded.generation, encoded.chunk,
+                                encoded.chunk == nullptr ? child.createCopy() : juce::ValueTree() });
+            newEntries.push_back (std::move (entry));
+        }
+
+        entries = std::move (newEntries);
+
+        // Forget any trees that have been removed from the Edit
+        std::set<juce::uint32> liveIDs;
+
+        for (auto& e : entries)
+            liveIDs.insert (e->id);
+
+        for (auto i = store->encoded.begin(); i != store->encoded.end();)
+        {
+            if (liveIDs.find (i->first) == liveIDs.end())
+                i = store->encoded.erase (i);
+            else
+                ++i;
+        }
+    }
+
+    return [s = store, root, chunks = std::move (chunks), f] () mutable
+    {
+        CRASH_TRACER
+        std::vector<std::shared_ptr<const EditFileFormat::EncodedChunk>> encodedChunks;
+        encodedChunks.reserve (chunks.size());
+
+        for (auto& c : chunks)
+        {
+            if (c.chunk == nullptr)
+                c.chunk = std::make_shared<const EditFileFormat::EncodedChunk> (EditFileFormat::encodeChunk (c.copy));
+
+            encodedChunks.push_back (c.chunk);
+        }
+
+        {
+            // Keep the new chunks unless the trees have changed again since the snapshot
+            const juce::ScopedLock sl (s->lock);
+
+            for (auto& c : chunks)
+            {
+                auto found = s->encoded.find (c.id);
+
+                if (found != s->encoded.end() && found->second.generation == c.generation)
+                    found->second.chunk = c.chunk;
+            }
+        }
+
+        // Only replace the Edit once the new file has been written in full
+        juce::TemporaryFile tempFile (f);
+
+        {
+            juce::FileOutputStream out (tempFile.getFile());
+
+            if (! out.openedOk())
+                return false;
+
+            if (! EditFileFormat::writeBinary (EditFileFormat::encodeChunk (root), encodedChunks, out))
+                return false;
+
+            out.flush();
+
+            if (! out.getStatus().wasOk())
+                return false;
+        }
+
+        return tempFile.overwriteTargetFileWithTemporary();
+    };
+}
+
+} // namespace tracktion_engine
@@ -0,0 +1,68 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+//==============================================================================
+/**
+    Keeps the encoded chunks of an Edit's top-level trees between saves so that
+    a binary save only needs to re-encode the trees that have changed since the
+    last one.
+
+    Each Edit owns one of these, created by its first binary save, so Edits that
+    are only ever saved as XML don't track anything. Changes are tracked on the
+    message thread by a listener on each top-level tree, and the chunks are encoded
+    on whichever thread runs the job returned from createWriteJob().
+*/
+class EditChunkCache
+{
+public:
+    EditChunkCache (const juce::ValueTree& editState);
+    ~EditChunkCache();
+
+    /** Snapshots the changed parts of the Edit and returns a job that will encode them
+        and write the whole Edit to the given file.
+        Only the trees that have changed are copied here so this is quick to call.
+    */
+    std::function<bool()> createWriteJob (const juce::File&);
+
+private:
+    struct Encoded
+    {
+        std::shared_ptr<const EditFileFormat::EncodedChunk> chunk;
+        juce::uint32 generation = 0;
+    };
+
+    // This is shared with any pending write jobs so can outlive the cache
+    struct Store
+    {
+        juce::CriticalSection lock;
+        std::map<juce::uint32, Encoded> encoded;
+        juce::uint32 nextID = 0;
+    };
+
+    struct Entry;
+
+    struct PendingChunk
+    {
+        juce::uint32 id, generation;
+        std::shared_ptr<const EditFileFormat::EncodedChunk> chunk;
+        juce::ValueTree copy;
+    };
+
+    juce::ValueTree state;
+    std::vector<std::unique_ptr<Entry>> entries; // Only used on the message thread
+    std::shared_ptr<Store> store { std::make_shared<Store>() };
+
+    JUCE_DECLARE_NON_COPYABLE (EditChunkCache)
+};
+
+} // namespace tracktion_engine
@@ -0,0 +1,286 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+int EditFileFormat::getMagicNumber()
+{
+    return (int) ByteOrder::littleEndianInt ("TKNE");
+}
+
+EditFileFormat::Type EditFileFormat::detectType (const File& f)
+{
+    FileInputStream in (f);
+
+    if (! in.openedOk())
+        return Type::unknown;
+
+    char header[64] = {};
+    auto numRead = in.read (header, sizeof (header));
+
+    if (numRead <= 0)
+        return Type::unknown;
+
+    if (numRead >= 4 && (int) ByteOrder::littleEndianInt (header) == getMagicNumber())
+        return Type::binary;
+
+    int pos = 0;
+
+    // skip any UTF-8 byte order mark
+    if (numRead >= 3 && (uint8) header[0] == 0xef && (uint8) header[1] == 0xbb && (uint8) header[2] == 0xbf)
+        pos = 3;
+
+    while (pos < numRead && CharacterFunctions::isWhitespace (header[pos]))
+        ++pos;
+
+    if (pos < numRead && header[pos] == '<')
+        return Type::xml;
+
+    return Type::legacyBinary;
+}
+
+ValueTree EditFileFormat::readEditState (const File& f)
+{
+    switch (detectType (f))
+    {
+        case Type::binary:
+            return Reader (f).readAll();
+
+        case Type::xml:
+            if (auto xml = std::unique_ptr<XmlElement> (XmlDocument::parse (f)))
+                return ValueTree::fromXml (*xml);
+
+            break;
+
+        case Type::legacyBinary:
+        {
+            FileInputStream is (f);
+
+            if (is.openedOk())
+                return ValueTree::readFromStream (is);
+
+            break;
+        }
+
+        case Type::unknown:
+        default:
+            break;
+    }
+
+    return {};
+}
+
+EditFileFormat::EncodedChunk EditFileFormat::encodeChunk (const ValueTree& v)
+{
+    EncodedChunk chunk { v.getType(), {} };
+    MemoryOutputStream out (chunk.data, false);
+    v.writeToStream (out);
+    out.flush();
+
+    return chunk;
+}
+
+bool EditFileFormat::writeBinary (const EncodedChunk& root,
+                                  const std::vector<std::shared_ptr<const EncodedChunk>>& children,
+                                  OutputStream& out)
+{
+    CRASH_TRACER
+    MemoryOutputStream header;
+    header.writeInt (getMagicNumber());
+    header.writeInt (currentVersion);
+    header.writeInt ((int) children.size());
+
+    int64 offset = 0;
+
+    auto writeChunkEntry = [&header, &offset] (const EncodedChunk& c)
+    {
+        header.writeInt64 (offset);
+        header.writeInt64 ((int64) c.data.getSize());
+        offset += (int64) c.data.getSize();
+    };
+
+    writeChunkEntry (root);
+
+    for (auto& child : children)
+    {
+        jassert (child != nullptr);
+        header.writeString (child->type.toString());
+        writeChunkEntry (*child);
+    }
+
+    if (! out.write (header.getData(), header.getDataSize())
+         || ! out.write (root.data.getData(), root.data.getSize()))
+        return false;
+
+    for (auto& child : children)
+        if (! out.write (child->data.getData(), child->data.getSize()))
+            return false;
+
+    return true;
+}
+
+bool EditFileFormat::writeBinary (const ValueTree& editState, OutputStream& out)
+{
+    jassert (editState.isValid());
+
+    ValueTree root (editState.getType());
+    root.copyPropertiesFrom (editState, nullptr);
+
+    std::vector<std::shared_ptr<const EncodedChunk>> children;
+    children.reserve ((size_t) editState.getNumChildren());
+
+    for (const auto& child : editState)
+        children.push_back (std::make_shared<const EncodedChunk> (encodeChunk (child)));
+
+    return writeBinary (encodeChunk (root), children, out);
+}
+
+bool EditFileFormat::writeBinary (const ValueTree& editState, const File& f)
+{
+    TemporaryFile tempFile (f);
+
+    {
+        FileOutputStream out (tempFile.getFile());
+
+        if (! out.openedOk())
+            return false;
+
+        if (! writeBinary (editState, out))
+            return false;
+
+        out.flush();
+
+        if (! out.getStatus().wasOk())
+            return false;
+    }
+
+    return tempFile.overwriteTargetFileWithTemporary();
+}
+
+//==============================================================================
+EditFileFormat::Reader::Reader (const File& f)
+    : mappedFile (std::make_unique<MemoryMappedFile> (f, MemoryMappedFile::readOnly))
+{
+    if (mappedFile->getData() == nullptr)
+        return;
+
+    MemoryInputStream in (mappedFile->getData(), mappedFile->getSize(), false);
+
+    if (in.readInt() != getMagicNumber())
+        return;
+
+    version = in.readInt();
+
+    if (version < 1 || version > currentVersion)
+    {
+        TRACKTION_LOG_ERROR ("Unsupported binary Edit version: " + String (version));
+        return;
+    }
+
+    auto numChildren = in.readInt();
+
+    // Each entry takes at least a terminated type name and two int64s
+    if (numChildren < 0 || numChildren > in.getNumBytesRemaining() / 17)
+        return;
+
+    auto readChunkEntry = [&in] (Chunk& c)
+    {
+        c.offset = in.readInt64();
+        c.size = in.readInt64();
+    };
+
+    readChunkEntry (rootChunk);
+    chunks.resize ((size_t) numChildren);
+
+    for (auto& c : chunks)
+    {
+        if (in.isExhausted())
+            return;
+
+        c.type = Identifier (in.readString());
+        readChunkEntry (c);
+    }
+
+    // Chunk offsets are relative to the end of the header
+    auto dataStart = in.getPosition();
+    auto fileSize = (int64) mappedFile->getSize();
+
+    auto isInRange = [dataStart, fileSize] (Chunk& c)
+    {
+        // Compared against what's left of the file rather than added up, so that a
+        // corrupt offset or size can't overflow
+        const auto dataSize = fileSize - dataStart;
+
+        if (c.offset < 0 || c.size < 0 || c.offset > dataSize || c.size > dataSize - c.offset)
+            return false;
+
+        c.offset += dataStart;
+        return true;
+    };
+
+    if (! isInRange (rootChunk))
+        return;
+
+    for (auto& c : chunks)
+        if (! isInRange (c))
+            return;
+
+    valid = true;
+}
+
+ValueTree EditFileFormat::Reader::readChunk (const Chunk& c) const
+{
+    if (! valid)
+        return {};
+
+    return ValueTree::readFromData (addBytesToPointer (mappedFile->getData(), c.offset), (size_t) c.size);
+}
+
+ValueTree EditFileFormat::Reader::readAll() const
+{
+    CRASH_TRACER
+    auto root = readChunk (rootChunk);
+
+    if (! root.isValid())
+        return {};
+
+    // Decode the chunks in a handful of batches rather than one task per child
+    // as an Edit can have thousands of small top-level trees
+    const int numChildren = (int) chunks.size();
+    const int numTasks = jlimit (1, jmax (1, SystemStats::getNumCpus()), numChildren);
+    std::vector<ValueTree> children ((size_t) numChildren);
+    std::vector<std::future<void>> tasks;
+
+    for (int task = 1; task < numTasks; ++task)
+        tasks.push_back (std::async (std::launch::async, [this, &children, task, numTasks, numChildren]
+                                     {
+                                         for (int i = task; i < numChildren; i += numTasks)
+                                             children[(size_t) i] = readChunk (chunks[(size_t) i]);
+                                     }));
+
+    for (int i = 0; i < numChildren; i += numTasks)
+        children[(size_t) i] = readChunk (chunks[(size_t) i]);
+
+    for (auto& t : tasks)
+        t.wait();
+
+    for (auto& child : children)
+    {
+        if (! child.isValid())
+            return {};
+
+        root.appendChild (child, nullptr);
+    }
+
+    return root;
+}
+
+} // namespace tracktion_engine
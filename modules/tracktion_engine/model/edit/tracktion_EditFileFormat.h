@@ -0,0 +1,121 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+//==============================================================================
+/**
+    Reads and writes the versioned binary Edit format.
+
+    A binary Edit file starts with a header holding a magic number and a format
+    version, followed by a table of chunks. The first chunk holds the EDIT tree's
+    properties and each following chunk holds one of its top-level children
+    (tracks, tempo sequence, etc.), encoded with ValueTree::writeToStream.
+
+    Because every chunk can be decoded on its own, a load can decode the chunks
+    concurrently.
+
+    Binary Edits have only ever been written with the current Edit schema, so unlike
+    XML and legacy binary files they don't need to go through OldEditConversion.
+    If the schema changes, bump currentVersion and upgrade older files' trees here.
+*/
+struct EditFileFormat
+{
+    /** The kinds of Edit file that can be detected. */
+    enum class Type
+    {
+        unknown,        /**< Empty, missing or unrecognised file. */
+        xml,            /**< An XML Edit. */
+        legacyBinary,   /**< A plain ValueTree::writeToStream dump, as written by older autosaves. */
+        binary          /**< The chunked binary format. */
+    };
+
+    /** Sniffs the start of a file to find out which format it's in.
+        This only reads the first few bytes so is quick to call.
+    */
+    static Type detectType (const juce::File&);
+
+    /** Loads an Edit state from any of the supported formats, or returns an invalid tree.
+        N.B. this doesn't run any legacy conversions.
+    */
+    static juce::ValueTree readEditState (const juce::File&);
+
+    /** Writes an Edit state in the chunked binary format. */
+    static bool writeBinary (const juce::ValueTree& editState, juce::OutputStream&);
+
+    /** Writes an Edit state in the chunked binary format.
+        The file is written to a temporary file first and only replaces the
+        original once it's been written successfully.
+    */
+    static bool writeBinary (const juce::ValueTree& editState, const juce::File&);
+
+    //==============================================================================
+    /** A single tree, already encoded as a chunk. */
+    struct EncodedChunk
+    {
+        juce::Identifier type;
+        juce::MemoryBlock data;
+    };
+
+    /** Encodes a tree so it can be written as a chunk. */
+    static EncodedChunk encodeChunk (const juce::ValueTree&);
+
+    /** Writes a binary Edit from chunks that have already been encoded.
+        The root chunk should only hold the EDIT tree's properties.
+    */
+    static bool writeBinary (const EncodedChunk& root,
+                             const std::vector<std::shared_ptr<const EncodedChunk>>& children,
+                             juce::OutputStream&);
+
+    /** The current version of the binary format. */
+    static constexpr int currentVersion = 1;
+
+    //==============================================================================
+    /**
+        Memory-maps a binary Edit file and decodes it.
+    */
+    class Reader
+    {
+    public:
+        Reader (const juce::File&);
+
+        /** Returns true if the file was a readable binary Edit. */
+        bool isValid() const                            { return valid; }
+
+        /** Returns the version the file was written with. */
+        int getVersion() const                          { return version; }
+
+        /** Decodes the whole Edit, decoding the top-level children concurrently. */
+        juce::ValueTree readAll() const;
+
+    private:
+        struct Chunk
+        {
+            juce::Identifier type;
+            juce::int64 offset = 0, size = 0;
+        };
+
+        std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+        Chunk rootChunk;
+        std::vector<Chunk> chunks;
+        int version = 0;
+        bool valid = false;
+
+        juce::ValueTree readChunk (const Chunk&) const;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Reader)
+    };
+
+private:
+    static int getMagicNumber();
+};
+
+} // namespace tracktion_engine
@@ -23,10 +23,11 @@ struct ThreadedEditFileWriter   : private Thread
         jassert (pending.isEmpty());
     }
 
-    void writeTreeToFile (ValueTree&& v, const File& f)
+    /** Adds a job that serialises and writes something to disk. */
+    void addJob (std::function<void()> job)
     {
         TRACKTION_ASSERT_MESSAGE_THREAD
-        pending.add (std::pair<ValueTree, File> (v, f));
+        pending.add (std::move (job));
         waiter.signal();
         startThread();
     }
@@ -47,20 +48,19 @@ private:
         while (! threadShouldExit())
         {
             while (! pending.isEmpty())
-                writeToFile (pending.removeAndReturn (0));
+            {
+                // Leave the job in the queue until it's done so flushAllFiles() waits for it
+                if (auto job = pending.getFirst())
+                    job();
+
+                pending.remove (0);
+            }
 
             waiter.wait (1000);
         }
     }
 
-    void writeToFile (std::pair<ValueTree, File> item)
-    {
-        item.second.deleteFile();
-        FileOutputStream os (item.second);
-        item.first.writeToStream (os);
-    }
-
-    juce::Array<std::pair<ValueTree, File>, CriticalSection> pending;
+    juce::Array<std::function<void()>, CriticalSection> pending;
     WaitableEvent waiter;
 };
 
@@ -130,7 +130,7 @@ private:
 struct EditFileOperations::SharedDataPimpl
 {
     SharedDataPimpl (Edit& e)
-        : data (cache->get (e))
+        : edit (e), data (cache->get (e))
     {
         jassert (data);
     }
@@ -141,11 +141,18 @@ struct EditFileOperations::SharedDataPimpl
         cache->cleanUp();
     }
 
-    void writeValueTreeToDisk (ValueTree&& v, const File& f)
+    void writeEditToDiskInBackground (const File& f)
+    {
+        editFileWriter->addJob ([job = getChunkCache (edit).createWriteJob (f)] { job(); });
+    }
+
+    bool writeEditToDisk (const File& f)
     {
-        editFileWriter->writeTreeToFile (std::move (v), f);
+        return getChunkCache (edit).createWriteJob (f)();
     }
 
+    Edit& edit;
+
     SharedResourcePointer<SharedEditFileDataCache> cache;
     std::shared_ptr<SharedEditFileDataCache::Data> data;
     SharedResourcePointer<ThreadedEditFileWriter> editFileWriter;
@@ -165,6 +172,16 @@ EditFileOperations::~EditFileOperations()
 {
 }
 
+EditChunkCache& EditFileOperations::getChunkCache (Edit& edit)
+{
+    // This belongs to the Edit rather than the shared data, which goes whenever
+    // the last EditFileOperations does, so the chunks are kept between saves
+    if (edit.chunkCache == nullptr)
+        edit.chunkCache = std::make_unique<EditChunkCache> (edit.state);
+
+    return *edit.chunkCache;
+}
+
 File EditFileOperations::getEditFile() const
 {
     return edit.editFileRetriever();
@@ -187,7 +204,7 @@ bool EditFileOperations::writeToFile (const File& file, bool writeQuickBinaryVer
     {
         if (writeQuickBinaryVersion)
         {
-            sharedDataPimpl->writeValueTreeToDisk (edit.state.createCopy(), file);
+            sharedDataPimpl->writeEditToDiskInBackground (file);
         }
         else
         {
@@ -196,7 +213,9 @@ bool EditFileOperations::writeToFile (const File& file, bool writeQuickBinaryVer
             if (editSnapshot != nullptr)
                 editSnapshot->setState (edit.state, edit.getLength());
 
-            if (auto xml = std::unique_ptr<XmlElement> (edit.state.createXml()))
+            if (edit.engine.getEngineBehaviour().shouldSaveEditsInBinaryFormat())
+                ok = sharedDataPimpl->writeEditToDisk (file);
+            else if (auto xml = std::unique_ptr<XmlElement> (edit.state.createXml()))
                 ok = xml->writeTo (file);
 
             jassert (ok);
@@ -429,23 +448,52 @@ ValueTree loadEditFromProjectManager (ProjectManager& pm, ProjectItemID itemID)
     return {};
 }
 
-ValueTree loadEditFromFile (Engine& e, const File& f, ProjectItemID itemID)
+ValueTree loadEditFromFile (Engine& e, const File& f, ProjectItemID itemID, EditLoadProfiler* profiler)
 {
     CRASH_TRACER
     ValueTree state;
+    const auto type = EditFileFormat::detectType (f);
+    const EditLoadProfiler::ScopedEvent parseEvent (profiler, EditLoadProfiler::fileCategory, "parse", f.getFullPathName());
 
-    if (auto xml = std::unique_ptr<XmlElement> (XmlDocument::parse (f)))
+    switch (type)
     {
-        updateLegacyEdit (*xml);
-        state = ValueTree::fromXml (*xml);
-    }
+        case EditFileFormat::Type::binary:
+        {
+            // Binary Edits are always written in the current schema, so unlike the
+            // other formats these don't need converting
+            EditFileFormat::Reader reader (f);
+            state = reader.readAll();
+            break;
+        }
 
-    if (! state.isValid())
-    {
-        FileInputStream is (f);
+        case EditFileFormat::Type::xml:
+        {
+            if (auto xml = std::unique_ptr<XmlElement> (XmlDocument::parse (f)))
+            {
+                {
+                    const EditLoadProfiler::ScopedEvent legacyEvent (profiler, EditLoadProfiler::fileCategory, "updateLegacyEdit");
+                    updateLegacyEdit (*xml);
+                }
+
+                state = ValueTree::fromXml (*xml);
+            }
 
-        if (is.openedOk())
-            state = updateLegacyEdit (ValueTree::readFromStream (is));
+            break;
+        }
+
+        case EditFileFormat::Type::legacyBinary:
+        {
+            FileInputStream is (f);
+
+            if (is.openedOk())
+                state = updateLegacyEdit (ValueTree::readFromStream (is));
+
+            break;
+        }
+
+        case EditFileFormat::Type::unknown:
+        default:
+            break;
     }
 
     if (! state.isValid())
@@ -459,9 +507,9 @@ ValueTree loadEditFromFile (Engine& e, const File& f, ProjectItemID itemID)
     return state;
 }
 
-std::unique_ptr<Edit> loadEditFromFile (Engine& engine, const juce::File& editFile)
+std::unique_ptr<Edit> loadEditFromFile (Engine& engine, const juce::File& editFile, EditLoadProfiler* profiler)
 {
-    auto editState = loadEditFromFile (engine, editFile, {});
+    auto editState = loadEditFromFile (engine, editFile, {}, profiler);
     auto id = ProjectItemID::fromProperty (editState, IDs::projectID);
     
     if (! id.isValid())
@@ -480,6 +528,8 @@ std::unique_ptr<Edit> loadEditFromFile (Engine& engine, const juce::File& editFi
         [editFile] { return editFile; },
         {}
     };
+
+    options.loadProfiler = profiler;
     
     return std::make_unique<Edit> (options);
 }
@@ -46,11 +46,15 @@ private:
 
     juce::Time& timeOfLastSave;
     EditSnapshot::Ptr& editSnapshot;
+
+    static EditChunkCache& getChunkCache (Edit&);
 };
 
 //==============================================================================
-/** Loads an edit from file, ready for playback / edtiing */
-std::unique_ptr<Edit> loadEditFromFile (Engine&, const juce::File&);
+/** Loads an edit from file, ready for playback / edtiing.
+    If an EditLoadProfiler is supplied, it'll be filled in with timings for the load.
+*/
+std::unique_ptr<Edit> loadEditFromFile (Engine&, const juce::File&, EditLoadProfiler* profiler = nullptr);
 
 /** Creates a new edit for a file, ready for playback / edtiing */
 std::unique_ptr<Edit> createEmptyEdit (Engine&, const juce::File&);
@@ -61,8 +65,9 @@ juce::ValueTree loadEditFromProjectManager (ProjectManager&, ProjectItemID);
 /** Legacy, will be deprecated soon. Use version that returns an edit.
     Loads a ValueTree from a file to load an Edit.
     If the file is empty, a new Edit state will be created with the given ProjectItemID.
+    If an EditLoadProfiler is supplied, the time taken to parse the file will be added to it.
 */
-juce::ValueTree loadEditFromFile (Engine&, const juce::File&, ProjectItemID);
+juce::ValueTree loadEditFromFile (Engine&, const juce::File&, ProjectItemID, EditLoadProfiler* profiler = nullptr);
 
 /** Legacy, will be deprecated soon. Use version that returns an edit.
     Creates an empty Edit with no project. */
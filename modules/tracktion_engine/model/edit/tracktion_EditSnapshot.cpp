@@ -221,7 +221,7 @@ void EditSnapshot::refreshFromProjectItem (ProjectItem::Ptr pi)
         return;
 
     sourceFile = pi->getSourceFile();
-    auto newState = loadValueTree (sourceFile, true);
+    auto newState = EditFileFormat::readEditState (sourceFile);
 
     if (! newState.hasType (IDs::EDIT))
         return;
@@ -164,6 +164,14 @@ int TracktionArchiveFile::indexOfFile (const String& name) const
     return -1;
 }
 
+File TracktionArchiveFile::getDestinationFile (int index, const File& destDirectory) const
+{
+    if (entries[index] != nullptr)
+        return destDirectory.getChildFile (getOriginalFileName (index));
+
+    return {};
+}
+
 std::unique_ptr<InputStream> TracktionArchiveFile::createStoredInputStream (int index) const
 {
     if (entries[index] != nullptr)
@@ -181,7 +189,7 @@ bool TracktionArchiveFile::extractFile (int index, const File& destDirectory, Fi
     if (! destDirectory.createDirectory())
         return false;
 
-    auto destFile = destDirectory.getChildFile (getOriginalFileName (index));
+    auto destFile = getDestinationFile (index, destDirectory);
     fileCreated = destFile;
 
     if (askBeforeOverwriting && destFile.existsAsFile())
@@ -236,8 +244,106 @@ bool TracktionArchiveFile::extractFile (int index, const File& destDirectory, Fi
     return true;
 }
 
-bool TracktionArchiveFile::extractAll (const File& destDirectory, Array<File>& filesCreated)
+//==============================================================================
+static bool extractEntriesConcurrently (TracktionArchiveFile& archive, const File& destDirectory,
+                                        int numThreads, Array<File>& filesCreated,
+                                        const std::function<bool (float)>& progressCallback)
+{
+    struct ExtractJob  : public ThreadPoolJob
+    {
+        ExtractJob (TracktionArchiveFile& a, const File& dest, int i)
+            : ThreadPoolJob ("Archive Extract"), archive (a), destDir (dest), index (i)
+        {
+        }
+
+        JobStatus runJob() override
+        {
+            CRASH_TRACER
+            FloatVectorOperations::disableDenormalisedNumberSupport();
+
+            if (! shouldExit())
+                ok = archive.extractFile (index, destDir, fileCreated, false);
+
+            finished.signal();
+            return jobHasFinished;
+        }
+
+        TracktionArchiveFile& archive;
+        const File destDir;
+        const int index;
+        File fileCreated;
+        WaitableEvent finished;
+        bool ok = false;
+    };
+
+    if (! destDirectory.createDirectory())
+        return false;
+
+    // If an archive holds the same name more than once, only the last one is extracted,
+    // as it would end up overwriting the others anyway and they mustn't be written at once
+    Array<int> indexes;
+    std::set<File> destinations;
+
+    for (int i = archive.getNumFiles(); --i >= 0;)
+        if (destinations.insert (archive.getDestinationFile (i, destDirectory)).second)
+            indexes.insert (0, i);
+
+    auto numFiles = indexes.size();
+
+    if (numFiles == 0)
+        return true;
+
+    OwnedArray<ExtractJob> jobs;
+    ThreadPool pool (jlimit (1, numFiles, numThreads));
+
+    for (auto index : indexes)
+        pool.addJob (jobs.add (new ExtractJob (archive, destDirectory, index)), false);
+
+    bool ok = true;
+
+    for (int i = 0; i < numFiles; ++i)
+    {
+        auto job = jobs.getUnchecked (i);
+
+        while (! job->finished.wait (100))
+        {
+            if (progressCallback && ! progressCallback (i / (float) numFiles))
+            {
+                pool.removeAllJobs (true, -1);
+                ok = false;
+                break;
+            }
+        }
+
+        if (! ok)
+            break;
+
+        if (job->ok && job->fileCreated.exists())
+            filesCreated.add (job->fileCreated);
+
+        ok = job->ok;
+
+        if (! ok)
+        {
+            pool.removeAllJobs (true, -1);
+            break;
+        }
+    }
+
+    // Jobs still running when we bailed out may have created files after we stopped collecting them
+    if (! ok)
+        for (auto job : jobs)
+            if (job->ok && job->fileCreated.exists())
+                filesCreated.addIfNotAlreadyThere (job->fileCreated);
+
+    return ok;
+}
+
+bool TracktionArchiveFile::extractAll (const File& destDirectory, Array<File>& filesCreated, int numThreads)
 {
+    if (numThreads > 1)
+        return extractEntriesConcurrently (*this, destDirectory, numThreads, filesCreated, {});
+
     if (! destDirectory.createDirectory())
         return false;
 
@@ -279,15 +385,23 @@ public:
         if (! destDir.createDirectory())
             return jobHasFinished;
 
-        for (int i = 0; i < archive.getNumFiles(); ++i)
+        // Asking about overwriting needs the entries to be handled one at a time
+        if (! warnAboutOverwrite)
         {
+            ok = extractEntriesConcurrently (archive, destDir, SystemStats::getNumCpus(), filesCreated,
+                                             [this] (float p) { progress = p; return ! shouldExit(); });
+
             if (shouldExit())
-            {
-                wasAborted = true;
+                abort();
 
-                for (auto& f : filesCreated)
-                    f.deleteFile();
+            return jobHasFinished;
+        }
 
+        for (int i = 0; i < archive.getNumFiles(); ++i)
+        {
+            if (shouldExit())
+            {
+                abort();
                 break;
             }
 
@@ -306,6 +420,14 @@ public:
         return jobHasFinished;
     }
 
+    void abort()
+    {
+        wasAborted = true;
+
+        for (auto& f : filesCreated)
+            f.deleteFile();
+    }
+
     float getCurrentTaskProgress()
     {
         return progress;
@@ -315,7 +437,7 @@ public:
     File destDir;
     bool ok = false;
     bool& wasAborted;
-    float progress = 0;
+    std::atomic<float> progress { 0.0f };
     bool warnAboutOverwrite = false;
     Array<File>& filesCreated;
 };
@@ -331,178 +453,359 @@ bool TracktionArchiveFile::extractAllAsTask (const File& destDirectory, bool war
     return task.ok;
 }
 
-bool TracktionArchiveFile::addFile (const File& f, const File& rootDirectory, CompressionType compression)
+String TracktionArchiveFile::getStoredNameFor (const File& f, const File& rootDirectory)
 {
-    String name;
-
     if (f.isAChildOf (rootDirectory))
-        name = f.getRelativePathFrom (rootDirectory)
+        return f.getRelativePathFrom (rootDirectory)
                 .replaceCharacter ('\\', '/');
-    else
-        name = f.getFileName();
 
-    return addFile (f, name, compression);
+    return f.getFileName();
+}
+
+bool TracktionArchiveFile::addFile (const File& f, const File& rootDirectory, CompressionType compression)
+{
+    return addFile (f, getStoredNameFor (f, rootDirectory), compression);
 }
 
 bool TracktionArchiveFile::addFile (const File& f, const String& filenameToUse, CompressionType compression)
 {
-    // don't risk using ogg or flac on small audio files
-    if (compression != CompressionType::none && f.getSize() <= 16 * 1024)
-        compression = CompressionType::zip;
+    if (! FileInputStream (f).openedOk())
+        return false;
 
-    FileInputStream in (f);
+    FileOutputStream out (file);
+
+    if (! out.openedOk() || ! startAppending (out, f))
+        return false;
+
+    auto initialPosition = out.getPosition();
+    out.setPosition (indexOffset);
+
+    auto entry = std::make_unique<IndexEntry>();
+
+    if (! writeEntry (f, filenameToUse, compression, out, *entry))
+    {
+        needToWriteIndex = true;
+        return false;
+    }
+
+    return finishEntry (out, std::move (entry), initialPosition, f);
+}
+
+//==============================================================================
+struct ArchiveEncodeJob  : public ThreadPoolJob
+{
+    ArchiveEncodeJob (const std::function<bool (OutputStream&, TracktionArchiveFile::IndexEntry&)>& encoder,
+                      const File& archiveFile)
+        : ThreadPoolJob ("Archive Encode"),
+          encode (encoder), segment (archiveFile, TemporaryFile::useHiddenFile)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        CRASH_TRACER
+        FloatVectorOperations::disableDenormalisedNumberSupport();
+
+        if (! shouldExit())
+        {
+            FileOutputStream out (segment.getFile());
+            ok = out.openedOk() && encode (out, entry);
+        }
+
+        finished.signal();
+        return jobHasFinished;
+    }
+
+    std::function<bool (OutputStream&, TracktionArchiveFile::IndexEntry&)> encode;
+    TemporaryFile segment;
+    TracktionArchiveFile::IndexEntry entry;
+    WaitableEvent finished;
     bool ok = false;
+};
 
-    if (in.openedOk())
+bool TracktionArchiveFile::addFiles (const Array<FileToAdd>& files, int numThreads,
+                                     StringArray& failedFiles,
+                                     std::function<bool (float)> progressCallback,
+                                     StringArray* cancelledFiles)
+{
+    if (files.isEmpty())
+        return true;
+
+    numThreads = jlimit (1, files.size(), numThreads);
+
+    // Each finished segment is a temporary copy of an encoded file, so only a few
+    // are allowed to be waiting to go in at once
+    const int maxJobsInFlight = numThreads * 2;
+
+    OwnedArray<ArchiveEncodeJob> jobs;
+    ThreadPool pool (numThreads);
+
+    auto addNextJob = [&]
     {
-        FileOutputStream out (file);
+        auto& f = files.getReference (jobs.size());
 
-        if (out.openedOk())
+        auto encoder = [this, f] (OutputStream& out, IndexEntry& entry)
         {
-            if (! valid)
-            {
-                out.setPosition (0);
-                out.writeInt (getMagicNumber());
-                out.writeInt (int (indexOffset));
-                valid = true;
-            }
+            return writeEntry (f.file, f.filenameToUse, f.compression, out, entry);
+        };
 
-            auto initialPosition = out.getPosition();
+        pool.addJob (jobs.add (new ArchiveEncodeJob (encoder, file)), false);
+    };
 
-            out.setPosition (indexOffset);
-            jassert (indexOffset < 2147483648);
+    auto shouldAbort = [&] (int numDone)
+    {
+        return progressCallback && ! progressCallback (numDone / (float) files.size());
+    };
 
-            if (indexOffset >= 2147483648)
-            {
-                TRACKTION_LOG_ERROR ("Archive too large when archiving file: " + f.getFileName());
-                return false;
-            }
+    bool allOk = true;
+
+    {
+        FileOutputStream out (file);
+        auto canWrite = out.openedOk() && startAppending (out, files.getReference (0).file);
+        bool aborted = false;
+        int i = 0;
 
-            auto filenameRoot = filenameToUse.substring (0, filenameToUse.lastIndexOfChar ('.'));
+        for (; i < files.size() && canWrite; ++i)
+        {
+            while (jobs.size() < files.size() && jobs.size() < i + maxJobsInFlight)
+                addNextJob();
 
-            std::unique_ptr<IndexEntry> entry (new IndexEntry());
-            entry->offset = indexOffset;
-            entry->length = 0;
-            entry->originalName = filenameToUse;
-            entry->storedName = filenameToUse;
+            auto& job = *jobs.getUnchecked (i);
+            auto& source = files.getReference (i).file;
 
-            switch (compression)
+            while (! job.finished.wait (100))
             {
-                case CompressionType::none:
+                if (shouldAbort (i))
                 {
-                    out.writeFromInputStream (in, -1);
+                    aborted = true;
                     break;
                 }
+            }
 
-                case CompressionType::zip:
-                {
-                    entry->storedName = filenameRoot + ".gz";
+            if (! aborted)
+                aborted = shouldAbort (i);
 
-                    GZIPCompressorOutputStream deflater (&out, 9, false);
-                    deflater.writeFromInputStream (in, -1);
-                    break;
-                }
+            if (aborted)
+                break;
 
-                case CompressionType::lossless:
+            if (job.ok)
+            {
+                FileInputStream in (job.segment.getFile());
+
+                if (in.openedOk())
                 {
-                    AudioFile af (engine, f);
+                    auto initialPosition = out.getPosition();
+                    out.setPosition (indexOffset);
+                    out.writeFromInputStream (in, -1);
 
-                    if (af.isOggFile() || af.isMp3File() || af.isFlacFile())
-                    {
-                        out.writeFromInputStream (in, -1); // no point re-compressing these
-                    }
-                    else
+                    auto entry = std::make_unique<IndexEntry>();
+                    entry->originalName = job.entry.originalName;
+                    entry->storedName = job.entry.storedName;
+
+                    if (finishEntry (out, std::move (entry), initialPosition, source))
                     {
-                        if (af.getBitsPerSample() > 24)
-                        {
-                            // FLAC can't do higher than 24 bits so just have to zip it instead..
-                            entry->storedName = filenameRoot + ".gz";
-
-                            GZIPCompressorOutputStream deflater (&out, 9, false);
-                            deflater.writeFromInputStream (in, -1);
-                        }
-                        else
-                        {
-                            entry->storedName = filenameRoot + ".flac";
-
-                            if (! AudioFileUtils::convertToFormat<FlacAudioFormat> (engine, f, out, 0, StringPairArray()))
-                            {
-                                needToWriteIndex = true;
-                                TRACKTION_LOG_ERROR ("Failed to add file to archive flac: " + f.getFileName());
-                                return false;
-                            }
-                        }
+                        job.segment.getFile().deleteFile();
+                        continue;
                     }
 
-                    break;
+                    // the archive has hit its size limit so nothing more can go in
+                    canWrite = false;
                 }
+            }
 
-                case CompressionType::lossyGoodQuality:
-                case CompressionType::lossyMediumQuality:
-                case CompressionType::lossyLowQuality:
-                {
-                    entry->storedName = filenameRoot + ".ogg";
-                    entry->originalName = entry->storedName;  // oggs get extracted as oggs, not named back to how they were
+            TRACKTION_LOG_ERROR ("Failed to add file to archive: " + source.getFileName());
+            failedFiles.add (source.getFileName());
+            needToWriteIndex = true;
+            allOk = false;
+        }
 
-                    auto quality = getOggQuality (compression);
-                    AudioFile af (engine, f);
+        // Anything left after an error has failed too, but after an abort it was just never written
+        for (; i < files.size(); ++i)
+        {
+            auto name = files.getReference (i).file.getFileName();
 
-                    if (! isWorthConvertingToOgg (af, quality))
-                    {
-                        FileInputStream fin (af.getFile());
+            if (! aborted)
+                failedFiles.add (name);
+            else if (cancelledFiles != nullptr)
+                cancelledFiles->add (name);
 
-                        if (! fin.openedOk())
-                        {
-                            needToWriteIndex = true;
-                            TRACKTION_LOG_ERROR ("Failed to add file to archive: " + f.getFileName());
-                            return false;
-                        }
+            allOk = false;
+        }
+    }
 
-                        out.writeFromInputStream (fin, -1);
-                    }
-                    else if (! AudioFileUtils::convertToFormat<OggVorbisAudioFormat> (engine, f, out, quality, StringPairArray()))
-                    {
-                        needToWriteIndex = true;
-                        TRACKTION_LOG_ERROR ("Failed to add file to archive ogg: " + f.getFileName());
-                        return false;
-                    }
+    pool.removeAllJobs (true, -1);
+    return allOk;
+}
 
-                    break;
-                }
+void TracktionArchiveFile::setZipCompressionLevel (int newLevel)
+{
+    zipCompressionLevel = jlimit (1, 9, newLevel);
+}
+
+void TracktionArchiveFile::setFlacCompressionLevel (int newLevel)
+{
+    flacCompressionLevel = jlimit (0, FlacAudioFormat().getQualityOptions().size() - 1, newLevel);
+}
+
+bool TracktionArchiveFile::startAppending (FileOutputStream& out, const File& source)
+{
+    if (! valid)
+    {
+        out.setPosition (0);
+        out.writeInt (getMagicNumber());
+        out.writeInt (int (indexOffset));
+        valid = true;
+    }
+
+    jassert (indexOffset < 2147483648);
+
+    if (indexOffset >= 2147483648)
+    {
+        TRACKTION_LOG_ERROR ("Archive too large when archiving file: " + source.getFileName());
+        return false;
+    }
+
+    return true;
+}
+
+bool TracktionArchiveFile::writeEntry (const File& f, const String& filenameToUse, CompressionType compression,
+                                       OutputStream& out, IndexEntry& entry) const
+{
+    // don't risk using ogg or flac on small audio files
+    if (compression != CompressionType::none && f.getSize() <= 16 * 1024)
+        compression = CompressionType::zip;
+
+    FileInputStream in (f);
+
+    if (! in.openedOk())
+    {
+        TRACKTION_LOG_ERROR ("Failed to add file to archive: " + f.getFileName());
+        return false;
+    }
+
+    auto filenameRoot = filenameToUse.substring (0, filenameToUse.lastIndexOfChar ('.'));
+
+    entry.originalName = filenameToUse;
+    entry.storedName = filenameToUse;
+
+    switch (compression)
+    {
+        case CompressionType::none:
+        {
+            out.writeFromInputStream (in, -1);
+            break;
+        }
+
+        case CompressionType::zip:
+        {
+            entry.storedName = filenameRoot + ".gz";
 
-                default:
+            GZIPCompressorOutputStream deflater (&out, zipCompressionLevel, false);
+            deflater.writeFromInputStream (in, -1);
+            break;
+        }
+
+        case CompressionType::lossless:
+        {
+            AudioFile af (engine, f);
+
+            if (af.isOggFile() || af.isMp3File() || af.isFlacFile())
+            {
+                out.writeFromInputStream (in, -1); // no point re-compressing these
+            }
+            else
+            {
+                if (af.getBitsPerSample() > 24)
                 {
-                    TRACKTION_LOG_ERROR ("Unknown compression type when archiving file: " + f.getFileName());
-                    jassertfalse;
-                    break;
+                    // FLAC can't do higher than 24 bits so just have to zip it instead..
+                    entry.storedName = filenameRoot + ".gz";
+
+                    GZIPCompressorOutputStream deflater (&out, zipCompressionLevel, false);
+                    deflater.writeFromInputStream (in, -1);
+                }
+                else
+                {
+                    entry.storedName = filenameRoot + ".flac";
+
+                    if (! AudioFileUtils::convertToFormat<FlacAudioFormat> (engine, f, out, flacCompressionLevel, StringPairArray()))
+                    {
+                        TRACKTION_LOG_ERROR ("Failed to add file to archive flac: " + f.getFileName());
+                        return false;
+                    }
                 }
             }
 
-            out.flush();
+            break;
+        }
 
-            jassert (out.getPosition() > indexOffset);
+        case CompressionType::lossyGoodQuality:
+        case CompressionType::lossyMediumQuality:
+        case CompressionType::lossyLowQuality:
+        {
+            entry.storedName = filenameRoot + ".ogg";
+            entry.originalName = entry.storedName;  // oggs get extracted as oggs, not named back to how they were
 
-            entry->length = jmax (int64 (0), out.getPosition() - indexOffset);
+            auto quality = getOggQuality (compression);
+            AudioFile af (engine, f);
 
-            jassert (indexOffset + entry->length < 2147483648);
+            if (! isWorthConvertingToOgg (af, quality))
+            {
+                FileInputStream fin (af.getFile());
+
+                if (! fin.openedOk())
+                {
+                    TRACKTION_LOG_ERROR ("Failed to add file to archive: " + f.getFileName());
+                    return false;
+                }
 
-            if (indexOffset + entry->length >= 2147483648)
+                out.writeFromInputStream (fin, -1);
+            }
+            else if (! AudioFileUtils::convertToFormat<OggVorbisAudioFormat> (engine, f, out, quality, StringPairArray()))
             {
-                out.setPosition (initialPosition);
-                out.truncate();
-                TRACKTION_LOG_ERROR ("Archive too large when archiving file: " + f.getFileName());
+                TRACKTION_LOG_ERROR ("Failed to add file to archive ogg: " + f.getFileName());
                 return false;
             }
 
-            indexOffset += entry->length;
-            needToWriteIndex = true;
-            ok = true;
+            break;
+        }
 
-            entries.add (entry.release());
+        default:
+        {
+            TRACKTION_LOG_ERROR ("Unknown compression type when archiving file: " + f.getFileName());
+            jassertfalse;
+            break;
         }
     }
 
-    return ok;
+    out.flush();
+    return true;
+}
+
+bool TracktionArchiveFile::finishEntry (FileOutputStream& out, std::unique_ptr<IndexEntry> entry,
+                                        int64 initialPosition, const File& source)
+{
+    out.flush();
+
+    jassert (out.getPosition() > indexOffset);
+
+    entry->offset = indexOffset;
+    entry->length = jmax (int64 (0), out.getPosition() - indexOffset);
+
+    jassert (indexOffset + entry->length < 2147483648);
+
+    if (indexOffset + entry->length >= 2147483648)
+    {
+        out.setPosition (initialPosition);
+        out.truncate();
+        TRACKTION_LOG_ERROR ("Archive too large when archiving file: " + source.getFileName());
+        return false;
+    }
+
+    indexOffset += entry->length;
+    needToWriteIndex = true;
+
+    entries.add (entry.release());
+    return true;
 }
 
 void TracktionArchiveFile::addFileInfo (const String& filename, const String& itemName, const String& itemValue)
@@ -38,21 +38,65 @@ public:
 
     int indexOfFile (const juce::String& name) const;
 
+    /** Returns the file that an entry will be extracted to.
+        Entries are always extracted flat, by their file name, directly inside the directory.
+    */
+    juce::File getDestinationFile (int index, const juce::File& destDirectory) const;
+
     /** Create a stream to read one of the archived objects. */
     std::unique_ptr<juce::InputStream> createStoredInputStream (int index) const;
 
     bool extractFile (int index, const juce::File& destDirectory,
                       juce::File& fileCreated, bool askBeforeOverwriting);
+    /** Extracts every entry to the given directory.
+        If numThreads is greater than 1, the entries are decoded concurrently.
+    */
     bool extractAll (const juce::File& destDirectory,
-                     juce::Array<juce::File>& filesCreated);
+                     juce::Array<juce::File>& filesCreated,
+                     int numThreads = 1);
     bool extractAllAsTask (const juce::File& destDirectory,
                            bool warnAboutOverwrite,
                            juce::Array<juce::File>& filesCreated,
                            bool& wasAborted);
 
+    /** Returns the name a file is stored under when it's added relative to a directory. */
+    static juce::String getStoredNameFor (const juce::File&, const juce::File& rootDirectory);
+
     bool addFile (const juce::File&, const juce::File& rootDirectory, CompressionType);
     bool addFile (const juce::File&, const juce::String& filenameToUse, CompressionType);
 
+    //==============================================================================
+    /** Describes a file to be added by addFiles(). */
+    struct FileToAdd
+    {
+        juce::File file;
+        juce::String filenameToUse;
+        CompressionType compression = CompressionType::zip;
+    };
+
+    /** Adds a batch of files, encoding them concurrently.
+        Each file is compressed on one of numThreads worker threads into a temporary
+        segment next to the archive, and the finished segments are streamed into the
+        archive in order while later ones are still being encoded. At most twice
+        numThreads segments are kept at once. The index is written
+        last, when flush() is called.
+        The progress callback is called on this thread and can return false to abort.
+        Any files that couldn't be added are appended to failedFiles. Files that weren't
+        written because of an abort aren't failures, and are appended to cancelledFiles
+        if it's supplied.
+        @returns true if all the files were added
+    */
+    bool addFiles (const juce::Array<FileToAdd>&, int numThreads,
+                   juce::StringArray& failedFiles,
+                   std::function<bool (float progress)> progressCallback = {},
+                   juce::StringArray* cancelledFiles = nullptr);
+
+    /** Sets the deflate level (1 to 9) used for zip compressed entries. Defaults to 9. */
+    void setZipCompressionLevel (int newLevel);
+
+    /** Sets the FLAC quality option index used for lossless entries. Defaults to 0. */
+    void setFlacCompressionLevel (int newLevel);
+
     void addFileInfo (const juce::String& filename,
                       const juce::String& itemName,
                       const juce::String& itemValue);
@@ -86,10 +130,17 @@ private:
     juce::File file;
     juce::int64 indexOffset = 8;
     bool valid = false, needToWriteIndex;
+    int zipCompressionLevel = 9, flacCompressionLevel = 0;
 
     juce::OwnedArray<IndexEntry> entries;
     void readIndex();
 
+    bool startAppending (juce::FileOutputStream&, const juce::File& source);
+    bool writeEntry (const juce::File&, const juce::String& filenameToUse, CompressionType,
+                     juce::OutputStream&, IndexEntry&) const;
+    bool finishEntry (juce::FileOutputStream&, std::unique_ptr<IndexEntry>,
+                      juce::int64 initialPosition, const juce::File& source);
+
     static int getOggQuality (CompressionType);
     static int getMagicNumber();
 
@@ -278,23 +278,25 @@ void ExportJob::createArchiveFromTempFiles()
 
         destDir.findChildFiles (filesForDeletion, File::findFiles, true);
 
-        for (int i = 0; i < filesForDeletion.size(); ++i)
-        {
-            progress = 0.5f + 0.5f * i / filesForDeletion.size();
-
-            if (shouldExit())
-                break;
+        Array<TracktionArchiveFile::FileToAdd> filesToAdd;
 
+        for (auto& f : filesForDeletion)
+        {
             auto compression = TracktionArchiveFile::CompressionType::zip;
-            const File f (filesForDeletion[i]);
 
             if (AudioFile (srcProject->engine, f).isValid())
                 compression = compressionType;
 
-            if (! archive->addFile (f, destDir, compression))
-                failedFiles.add (f.getFileName());
+            filesToAdd.add ({ f, TracktionArchiveFile::getStoredNameFor (f, destDir), compression });
         }
 
+        archive->addFiles (filesToAdd, SystemStats::getNumCpus(), failedFiles,
+                           [this] (float p)
+                           {
+                               progress = 0.5f + 0.5f * p;
+                               return ! shouldExit();
+                           });
+
         filesForDeletion.clear();
         filesForDeletion.add (destDir);
     }
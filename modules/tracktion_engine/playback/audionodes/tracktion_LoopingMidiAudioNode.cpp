@@ -0,0 +1,322 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+LoopingMidiAudioNode::LoopingMidiAudioNode (MidiMessageSequence loopSequenceInBeats,
+                                            double loopLengthBeats, double contentStart,
+                                            const TempoSequence::TempoSections& tempos,
+                                            Range<int> chans,
+                                            EditTimeRange editPos,
+                                            CachedValue<float>& volumeDb_,
+                                            CachedValue<bool>& mute_,
+                                            Clip& sourceClip, const LoopingMidiAudioNode* nodeToReplace)
+    : sequence (std::move (loopSequenceInBeats)),
+      loopLength (loopLengthBeats),
+      contentStartBeat (contentStart),
+      tempoSections (tempos),
+      editSection (editPos),
+      channelNumbers (chans),
+      volumeDb (volumeDb_),
+      mute (mute_),
+      clip (&sourceClip),
+      wasMute (mute_),
+      shouldCreateMessagesForTime (nodeToReplace == nullptr)
+{
+    jassert (channelNumbers.getStart() > 0 && channelNumbers.getEnd() <= 16);
+    jassert (loopLength > 0.0);
+
+    if (nodeToReplace != nullptr)
+        midiSourceID = nodeToReplace->midiSourceID;
+
+    sequence.updateMatchedPairs();
+}
+
+//==============================================================================
+double LoopingMidiAudioNode::getContentBeat (double editTime) const
+{
+    return tempoSections.timeToBeats (editTime) - contentStartBeat;
+}
+
+double LoopingMidiAudioNode::getEditTime (double contentBeat) const
+{
+    return tempoSections.beatsToTime (contentBeat + contentStartBeat);
+}
+
+double LoopingMidiAudioNode::getBeatInLoop (double contentBeat) const
+{
+    return contentBeat - std::max (0.0, std::floor (contentBeat / loopLength)) * loopLength;
+}
+
+int LoopingMidiAudioNode::getFirstIndexAtOrAfter (double beatInLoop) const
+{
+    int start = 0, end = sequence.getNumEvents();
+
+    while (start < end)
+    {
+        auto mid = (start + end) / 2;
+
+        if (sequence.getEventTime (mid) < beatInLoop)
+            start = mid + 1;
+        else
+            end = mid;
+    }
+
+    return start;
+}
+
+//==============================================================================
+void LoopingMidiAudioNode::renderSection (const AudioRenderContext& rc, EditTimeRange editTime)
+{
+    if (rc.bufferForMidiMessages == nullptr)
+        return;
+
+    if (mute)
+    {
+        if (! wasMute)
+        {
+            wasMute = true;
+            createNoteOffs (*rc.bufferForMidiMessages, editTime.getStart(), rc.midiBufferOffset, rc.playhead.isPlaying());
+        }
+
+        return;
+    }
+
+    wasMute = false;
+
+    if (editTime.getEnd() <= editSection.getStart() || editTime.getStart() >= editSection.getEnd())
+        return;
+
+    if ((! rc.isContiguousWithPreviousBlock()) || editTime.getStart() <= editSection.getStart() + 0.00001 || shouldCreateMessagesForTime)
+    {
+        createMessagesForTime (editTime.getStart(), *rc.bufferForMidiMessages, rc.midiBufferOffset);
+        shouldCreateMessagesForTime = false;
+    }
+
+    addEvents (*rc.bufferForMidiMessages, editTime, rc.midiBufferOffset);
+
+    if (rc.isLastBlockOfLoop())
+        createNoteOffs (*rc.bufferForMidiMessages, editTime.getEnd(), rc.midiBufferOffset + editTime.getLength(), rc.playhead.isPlaying());
+}
+
+void LoopingMidiAudioNode::addEvents (MidiMessageArray& buffer, EditTimeRange editTime, double midiTimeOffset)
+{
+    auto numEvents = sequence.getNumEvents();
+
+    if (numEvents == 0)
+        return;
+
+    auto startBeat = getContentBeat (std::max (editTime.getStart(), editSection.getStart()));
+    auto endBeat   = getContentBeat (std::min (editTime.getEnd(), editSection.getEnd()));
+    auto volScale = dbToGain (volumeDb);
+
+    // Events right at the end of a repetition belong to it rather than to the next one,
+    // so this starts a repetition early to catch any that land on the start of the block
+    for (auto repetition = std::max (0.0, std::floor (startBeat / loopLength) - 1.0);
+         repetition * loopLength < endBeat; repetition += 1.0)
+    {
+        auto repetitionStart = repetition * loopLength;
+        auto endBeatInLoop = endBeat - repetitionStart;
+
+        for (int i = getFirstIndexAtOrAfter (startBeat - repetitionStart); i < numEvents; ++i)
+        {
+            auto& message = sequence.getEventPointer (i)->message;
+            auto beat = message.getTimeStamp();
+
+            if (beat >= endBeatInLoop)
+                break;
+
+            auto eventTime = getEditTime (repetitionStart + beat) - editTime.getStart();
+
+            if (message.isNoteOn())
+            {
+                MidiMessage m (message);
+                m.multiplyVelocity (volScale);
+                buffer.addMidiMessage (m, midiTimeOffset + jlimit (0.0, editTime.getLength(), eventTime), midiSourceID);
+            }
+            else
+            {
+                // nudge the note-ups backwards just a bit to make sure the ordering is correct
+                if (message.isNoteOff())
+                    eventTime -= 0.0001;
+
+                buffer.addMidiMessage (message, midiTimeOffset + jlimit (0.0, editTime.getLength(), eventTime), midiSourceID);
+            }
+        }
+    }
+
+    // Anything still playing when the clip ends needs to be stopped
+    auto clipEnd = editSection.getEnd() - 0.0001;
+
+    if (editTime.getStart() <= clipEnd && clipEnd < editTime.getEnd())
+    {
+        auto endBeatInLoop = getBeatInLoop (endBeat);
+
+        // if the clip ends right at the end of a repetition, its last notes haven't been stopped yet
+        if (endBeatInLoop == 0.0 && endBeat > 0.0)
+            endBeatInLoop = loopLength;
+
+        addNoteOffsForSoundingNotes (buffer, endBeatInLoop, midiTimeOffset + clipEnd - editTime.getStart());
+    }
+}
+
+void LoopingMidiAudioNode::createMessagesForTime (double editTime, MidiMessageArray& buffer, double midiTimeOffset)
+{
+    auto contentBeat = getContentBeat (std::max (editTime, editSection.getStart()));
+    auto beatInLoop = getBeatInLoop (contentBeat);
+
+    {
+        juce::Array<juce::MidiMessage> controllerMessages;
+
+        for (int i = channelNumbers.getStart(); i <= channelNumbers.getEnd(); ++i)
+        {
+            // Values set in an earlier repetition still hold until they're changed in this one
+            if (contentBeat >= loopLength)
+                sequence.createControllerUpdatesForTime (i, loopLength, controllerMessages);
+
+            sequence.createControllerUpdatesForTime (i, beatInLoop, controllerMessages);
+        }
+
+        for (auto& m : controllerMessages)
+            buffer.addMidiMessage (m, midiTimeOffset, midiSourceID);
+    }
+
+    if (! mute)
+    {
+        auto volScale = dbToGain (volumeDb);
+
+        for (int i = 0; i < sequence.getNumEvents(); ++i)
+        {
+            auto meh = sequence.getEventPointer (i);
+
+            if (meh->message.getTimeStamp() >= beatInLoop)
+                break;
+
+            // don't play notes that have already finished
+            if (meh->message.isNoteOn()
+                 && meh->noteOffObject != nullptr
+                 && meh->noteOffObject->message.getTimeStamp() > beatInLoop)
+            {
+                MidiMessage m (meh->message);
+                m.multiplyVelocity (volScale);
+
+                // give these a tiny offset to make sure they're played after the controller updates
+                buffer.addMidiMessage (m, midiTimeOffset + 0.0001, midiSourceID);
+            }
+        }
+    }
+}
+
+void LoopingMidiAudioNode::addNoteOffsForSoundingNotes (MidiMessageArray& buffer, double beatInLoop, double midiTimeOffset)
+{
+    for (int i = 0; i < sequence.getNumEvents(); ++i)
+    {
+        auto meh = sequence.getEventPointer (i);
+
+        if (meh->message.getTimeStamp() >= beatInLoop)
+            break;
+
+        if (meh->message.isNoteOn()
+             && meh->noteOffObject != nullptr
+             && meh->noteOffObject->message.getTimeStamp() >= beatInLoop)
+            buffer.addMidiMessage (meh->noteOffObject->message, midiTimeOffset, midiSourceID);
+    }
+}
+
+void LoopingMidiAudioNode::createNoteOffs (MidiMessageArray& buffer, double editTime, double midiTimeOffset, bool isPlaying)
+{
+    if (editSection.containsInclusive (editTime))
+        addNoteOffsForSoundingNotes (buffer, getBeatInLoop (getContentBeat (editTime)), midiTimeOffset);
+
+    int activeChannels = 0;
+
+    for (int i = 0; i < sequence.getNumEvents(); ++i)
+    {
+        auto& m = sequence.getEventPointer (i)->message;
+
+        if (m.isNoteOn())
+            activeChannels |= (1 << m.getChannel());
+    }
+
+    for (int i = 1; i <= 16; ++i)
+    {
+        if ((activeChannels & (1 << i)) != 0)
+        {
+            buffer.addMidiMessage (MidiMessage::controllerEvent (i, 66 /* sustain pedal off */, 0), midiTimeOffset, midiSourceID);
+            buffer.addMidiMessage (MidiMessage::controllerEvent (i, 64 /* hold pedal off */, 0), midiTimeOffset, midiSourceID);
+
+            // NB: Some buggy plugins seem to fail to respond to note-ons if they are preceded
+            // by an all-notes-off, so avoid this while playing.
+            if (! isPlaying)
+                buffer.addMidiMessage (MidiMessage::allNotesOff (i), midiTimeOffset, midiSourceID);
+        }
+    }
+}
+
+//==============================================================================
+void LoopingMidiAudioNode::getAudioNodeProperties (AudioNodeProperties& info)
+{
+    info.hasAudio = false;
+    info.hasMidi = true;
+    info.numberOfChannels = 0;
+}
+
+bool LoopingMidiAudioNode::isReadyToRender()
+{
+    return true;
+}
+
+void LoopingMidiAudioNode::visitNodes (const VisitorFn& v)
+{
+    v (*this);
+}
+
+bool LoopingMidiAudioNode::purgeSubNodes (bool, bool keepMidi)
+{
+    return keepMidi;
+}
+
+void LoopingMidiAudioNode::prepareAudioNodeToPlay (const PlaybackInitialisationInfo&)
+{
+}
+
+void LoopingMidiAudioNode::releaseAudioNodeResources()
+{
+}
+
+void LoopingMidiAudioNode::renderOver (const AudioRenderContext& rc)
+{
+    callRenderAdding (rc);
+}
+
+void LoopingMidiAudioNode::renderAdding (const AudioRenderContext& rc)
+{
+    invokeSplitRender (rc, *this);
+}
+
+//==============================================================================
+LoopingMidiAudioNode* getLoopingClipIfPresentInNode (AudioNode* node, Clip& c)
+{
+    LoopingMidiAudioNode* existingNode = nullptr;
+
+    if (node != nullptr)
+        node->visitNodes ([&] (AudioNode& an)
+                          {
+                              if (existingNode == nullptr)
+                                  if (auto midiNode = dynamic_cast<LoopingMidiAudioNode*> (&an))
+                                      if (&midiNode->getClip() == &c)
+                                          existingNode = midiNode;
+                          });
+
+    return existingNode;
+}
+
+}
@@ -0,0 +1,78 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+/** An AudioNode that plays a looped MIDI clip from a single repetition of its loop.
+
+    The sequence's timestamps are in beats from the start of the repetition. Each block
+    is converted to beats with a copy of the tempo map and the matching part of the
+    repetition is played, so the node takes the same time to build and the same memory
+    however many times the clip loops.
+
+    @see MidiList::exportLoopToPlaybackMidiSequence
+*/
+class LoopingMidiAudioNode   : public AudioNode
+{
+public:
+    LoopingMidiAudioNode (juce::MidiMessageSequence loopSequenceInBeats,
+                          double loopLengthBeats, double contentStartBeat,
+                          const TempoSequence::TempoSections&,
+                          juce::Range<int> midiChannelNumbers,
+                          EditTimeRange editSection,
+                          juce::CachedValue<float>& volumeDb,
+                          juce::CachedValue<bool>& mute,
+                          Clip&, const LoopingMidiAudioNode* nodeToReplace);
+
+    void renderSection (const AudioRenderContext&, EditTimeRange editTime);
+
+    void getAudioNodeProperties (AudioNodeProperties&) override;
+    void visitNodes (const VisitorFn&) override;
+    bool purgeSubNodes (bool keepAudio, bool keepMidi) override;
+    void prepareAudioNodeToPlay (const PlaybackInitialisationInfo&) override;
+    bool isReadyToRender() override;
+    void releaseAudioNodeResources() override;
+    void renderOver (const AudioRenderContext&) override;
+    void renderAdding (const AudioRenderContext&) override;
+
+    Clip& getClip() const noexcept                  { return *clip; }
+
+private:
+    juce::MidiMessageSequence sequence;
+    const double loopLength, contentStartBeat;
+    const TempoSequence::TempoSections tempoSections;
+    EditTimeRange editSection;
+    juce::Range<int> channelNumbers;
+    juce::CachedValue<float>& volumeDb;
+    juce::CachedValue<bool>& mute;
+    juce::ReferenceCountedObjectPtr<Clip> clip;
+    MidiMessageArray::MPESourceID midiSourceID = MidiMessageArray::createUniqueMPESourceID();
+    bool wasMute = false, shouldCreateMessagesForTime = false;
+
+    //==============================================================================
+    double getContentBeat (double editTime) const;
+    double getEditTime (double contentBeat) const;
+    double getBeatInLoop (double contentBeat) const;
+    int getFirstIndexAtOrAfter (double beatInLoop) const;
+
+    void addEvents (MidiMessageArray&, EditTimeRange editTime, double midiTimeOffset);
+    void createMessagesForTime (double editTime, MidiMessageArray&, double midiTimeOffset);
+    void addNoteOffsForSoundingNotes (MidiMessageArray&, double beatInLoop, double midiTimeOffset);
+    void createNoteOffs (MidiMessageArray&, double editTime, double midiTimeOffset, bool isPlaying);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LoopingMidiAudioNode)
+};
+
+//==============================================================================
+/** Returns a LoopingMidiAudioNode if the AudioNode contains one for the given clip. */
+LoopingMidiAudioNode* getLoopingClipIfPresentInNode (AudioNode*, Clip&);
+
+} // namespace tracktion_engine
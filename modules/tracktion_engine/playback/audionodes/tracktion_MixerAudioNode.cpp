@@ -38,87 +38,213 @@ struct MultiCPU
     }
 
     //==============================================================================
+    /** Renders a set of inputs on the calling thread and any free mixer threads.
+        Each participating thread sums into its own Accumulator so no locks are needed,
+        then the caller adds the accumulators together pairwise once all the inputs
+        have been rendered.
+        Inputs are handed out most expensive first so a heavy input doesn't end up
+        being started last and holding up the whole block.
+    */
     struct ParallelMixOperation
     {
-        ParallelMixOperation (const AudioRenderContext& context, OwnedArray<AudioNode>& inputs)
-            : nodes (inputs), rc (context) {}
+        using Accumulator = MixerAudioNode::Accumulator;
 
-        LinkedListPointer<ParallelMixOperation> nextListItem;
+        ParallelMixOperation (const AudioRenderContext& context, MixerAudioNode& mixer)
+            : nodes (mixer.inputs), accumulators (mixer.accumulators),
+              renderOrder (mixer.renderOrder), inputCostsMs (mixer.inputCostsMs),
+              rc (context), mix64Bit (mixer.use64bitMixing && context.destBuffer != nullptr)
+        {
+            jassert (renderOrder.size() == (size_t) nodes.size());
+        }
 
         OwnedArray<AudioNode>& nodes;
-        CriticalSection outputBufferLock;
+        OwnedArray<Accumulator>& accumulators;
+        std::vector<int>& renderOrder;
+        std::vector<std::atomic<double>>& inputCostsMs;
         Atomic<int> nextNodeToPop, pendingNodes;
         WaitableEvent pendingNodeChange;
 
         const AudioRenderContext& rc;
-        double** buffer64 = nullptr;
+        const bool mix64Bit;
 
-        void processNode (AudioNode* node, juce::AudioBuffer<float>& buffer)
+        /** Renders the next input into the given slot's accumulator.
+            Slot 0 belongs to the thread calling perform(), mixer threads use their index + 1.
+            Returns false if there's nothing left to render.
+        */
+        bool processNextNode (int slot)
         {
-            processNode (*node, buffer);
+            if (! isPositiveAndBelow (slot, accumulators.size()))
+                return false;
+
+            const int index = popNextNode();
+
+            if (index >= 0)
+            {
+                const ScopedCpuMeter cpuMeter (inputCostsMs[(size_t) index], 0.2);
+                processNode (*nodes.getUnchecked (index), *accumulators.getUnchecked (slot));
+
+                if (--pendingNodes == 0)
+                    pendingNodeChange.signal();
+
+                return true;
+            }
 
-            if (--pendingNodes == 0)
-                pendingNodeChange.signal();
+            return false;
         }
 
         void perform()
         {
+            jassert (accumulators.size() > 0);
+
+            for (auto a : accumulators)
+                a->isUsed = false;
+
             pendingNodes = nodes.size();
             nextNodeToPop = nodes.size();
             auto& threadPool = *MultiCPU::MixerThreadPool::getInstanceWithoutCreating();
 
-            threadPool.addOperation (this);
+            auto operationIndex = threadPool.addOperation (this);
 
-            AudioScratchBuffer scratchBuffer (rc.destBuffer != nullptr ? rc.destBuffer->getNumChannels() : 256,
-                                              rc.destBuffer != nullptr ? rc.destBuffer->getNumSamples()  : 1);
-
-            while (auto node = popNextNode())
-                processNode (node, scratchBuffer.buffer);
+            while (processNextNode (0))
+            {}
 
             pendingNodeChange.wait();
 
-            threadPool.removeOperation (this);
+            threadPool.removeOperation (operationIndex);
+
+            sumAccumulatorsIntoDestination();
+            sortByCost();
         }
 
-        AudioNode* popNextNode()
+        /** Returns the index of the next input to render, or -1 if there are none left. */
+        int popNextNode()
         {
             const int i = --nextNodeToPop;
-            return i >= 0 ? nodes.getUnchecked(i) : nullptr;
+            return i >= 0 ? renderOrder[(size_t) i] : -1;
         }
 
     private:
-        void processNode (AudioNode& node, juce::AudioBuffer<float>& buffer)
+        int getNumChannels() const      { return rc.destBuffer != nullptr ? rc.destBuffer->getNumChannels() : 0; }
+
+        void startUsing (Accumulator& a)
+        {
+            a.isUsed = true;
+            a.midi.clear();
+
+            const int numChannels = getNumChannels();
+
+            if (numChannels == 0)
+                return;
+
+            if (mix64Bit)
+            {
+                a.buffer64.setSize (numChannels, rc.bufferNumSamples, false, false, true);
+                a.buffer64.clear();
+            }
+            else
+            {
+                a.buffer.setSize (numChannels, rc.bufferNumSamples, false, false, true);
+                a.buffer.clear();
+            }
+        }
+
+        void processNode (AudioNode& node, Accumulator& a)
         {
-            MidiMessageArray midiBuffer;
+            if (! a.isUsed)
+                startUsing (a);
 
-            buffer.setSize (rc.destBuffer != nullptr ? rc.destBuffer->getNumChannels() : 256,
-                            rc.destBuffer != nullptr ? rc.destBuffer->getNumSamples()  : 1);
+            a.scratchMidi.clear();
 
-            node.renderOver (AudioRenderContext (rc.playhead,
-                                                 rc.streamTime,
-                                                 rc.destBuffer != nullptr ? &buffer : nullptr,
-                                                 rc.destBufferChannels,
-                                                 0, rc.bufferNumSamples,
-                                                 &midiBuffer, rc.midiBufferOffset,
-                                                 rc.continuity, rc.isRendering));
+            if (mix64Bit)
+            {
+                a.scratch.setSize (getNumChannels(), rc.bufferNumSamples, false, false, true);
 
-            const ScopedLock sl (outputBufferLock);
+                node.renderOver (AudioRenderContext (rc.playhead, rc.streamTime,
+                                                     &a.scratch, rc.destBufferChannels,
+                                                     0, rc.bufferNumSamples,
+                                                     &a.scratchMidi, rc.midiBufferOffset,
+                                                     rc.continuity, rc.isRendering));
 
-            if (buffer64 != nullptr)
+                addBufferToDoubles (a.scratch, a.buffer64.getArrayOfWritePointers(), rc.bufferNumSamples);
+            }
+            else
             {
-                addBufferToDoubles (buffer, buffer64, rc.bufferNumSamples);
+                node.renderAdding (AudioRenderContext (rc.playhead, rc.streamTime,
+                                                       rc.destBuffer != nullptr ? &a.buffer : nullptr,
+                                                       rc.destBufferChannels,
+                                                       0, rc.bufferNumSamples,
+                                                       &a.scratchMidi, rc.midiBufferOffset,
+                                                       rc.continuity, rc.isRendering));
             }
-            else if (auto* dest = rc.destBuffer)
+
+            if (rc.bufferForMidiMessages != nullptr)
+                a.midi.mergeFromAndClear (a.scratchMidi);
+        }
+
+        void addAccumulator (Accumulator& dest, Accumulator& src)
+        {
+            if (! src.isUsed)
+                return;
+
+            if (! dest.isUsed)
+                startUsing (dest);
+
+            const int numSamples = rc.bufferNumSamples;
+
+            for (int i = getNumChannels(); --i >= 0;)
             {
-                const int numToCopy = jmin (buffer.getNumChannels(), dest->getNumChannels());
+                if (mix64Bit)
+                    FloatVectorOperations::add (dest.buffer64.getWritePointer (i), src.buffer64.getReadPointer (i), numSamples);
+                else
+                    FloatVectorOperations::add (dest.buffer.getWritePointer (i), src.buffer.getReadPointer (i), numSamples);
+            }
+
+            dest.midi.mergeFromAndClear (src.midi);
+        }
+
+        void sumAccumulatorsIntoDestination()
+        {
+            // Pairwise reduction so each buffer is only read once per level
+            const int num = accumulators.size();
 
-                for (int i = 0; i < numToCopy; ++i)
-                    dest->addFrom (i, rc.bufferStartSample, buffer, i, 0, rc.bufferNumSamples);
+            for (int stride = 1; stride < num; stride *= 2)
+                for (int i = 0; i + stride < num; i += stride * 2)
+                    addAccumulator (*accumulators.getUnchecked (i), *accumulators.getUnchecked (i + stride));
+
+            auto& result = *accumulators.getUnchecked (0);
+
+            if (! result.isUsed)
+                return;
+
+            if (auto dest = rc.destBuffer)
+            {
+                if (mix64Bit)
+                {
+                    addDoublesToBuffer (rc, result.buffer64);
+                }
+                else
+                {
+                    for (int i = dest->getNumChannels(); --i >= 0;)
+                        dest->addFrom (i, rc.bufferStartSample, result.buffer, i, 0, rc.bufferNumSamples);
+                }
             }
 
             if (rc.bufferForMidiMessages != nullptr)
-                rc.bufferForMidiMessages->mergeFromAndClear (midiBuffer);
+                rc.bufferForMidiMessages->mergeFromAndClear (result.midi);
         }
+
+        /** Sorts the render order cheapest first, as inputs are popped from the end. */
+        void sortByCost()
+        {
+            std::sort (renderOrder.begin(), renderOrder.end(),
+                       [this] (int a, int b)
+                       {
+                           return inputCostsMs[(size_t) a].load (std::memory_order_relaxed)
+                                    < inputCostsMs[(size_t) b].load (std::memory_order_relaxed);
+                       });
+        }
+
+        JUCE_DECLARE_NON_COPYABLE (ParallelMixOperation)
     };
 
     //==============================================================================
@@ -132,58 +258,86 @@ struct MultiCPU
             clearSingletonInstance();
         }
 
-        void addOperation (ParallelMixOperation* op)
+        /** Publishes an operation for the mixer threads to help with.
+            Returns the slot it was added to, or -1 if they're all busy in which case the
+            caller will just render everything itself.
+        */
+        int addOperation (ParallelMixOperation* op)
         {
+            for (int i = 0; i < maxNumOperations; ++i)
             {
-                const ScopedLock sl (opLock);
-                opList.insertNext (op);
+                ParallelMixOperation* expected = nullptr;
+
+                if (operations[i].op.compare_exchange_strong (expected, op))
+                {
+                    lastNotifyTimeMs.store (Time::getMillisecondCounterHiRes(), std::memory_order_relaxed);
+
+                    for (auto thread : threads)
+                        thread->notify();
+
+                    return i;
+                }
             }
 
-            for (auto thread : threads)
-                thread->notify();
+            return -1;
         }
 
-        void removeOperation (ParallelMixOperation* op)
+        /** Removes an operation, waiting for any threads that are still looking at it. */
+        void removeOperation (int index)
         {
-            const ScopedLock sl (opLock);
-            opList.remove (op);
+            if (index < 0)
+                return;
+
+            auto& slot = operations[index];
+            slot.op.store (nullptr);
+
+            while (slot.numUsers.load() != 0)
+                Thread::yield();
         }
 
-        void setNumThreads (int num)
+        void setNumThreads (int num, const AudioWorkerThreadOptions& options)
         {
-            if (threads.size() != num)
-            {
-                const ScopedLock sl (opLock);
+            bool optionsChanged = threadOptions.cpus != options.cpus
+                                   || threadOptions.deviceCallbackCPU != options.deviceCallbackCPU
+                                   || threadOptions.realtimePriority != options.realtimePriority;
 
+            if (threads.size() != num || optionsChanged)
+            {
                 threads.clear();
+                threadOptions = options;
 
                 while (threads.size() < num)
-                    threads.add (new MixerThread (*this));
+                    threads.add (new MixerThread (*this, threads.size() + 1));
             }
         }
 
-        bool process (juce::AudioBuffer<float>& buffer)
+        std::vector<AudioWorkerThreads::WorkerStats> getWorkerStats() const
         {
-            ParallelMixOperation* op = nullptr;
-            AudioNode* node = nullptr;
+            std::vector<AudioWorkerThreads::WorkerStats> stats;
 
-            {
-                const ScopedLock sl (opLock);
+            for (auto t : threads)
+                stats.push_back ({ t->cpu, t->latency.getAverageMs(), t->latency.getMaxMs() });
 
-                for (op = opList.get(); op != nullptr; op = op->nextListItem)
-                {
-                    if (auto n = op->popNextNode())
-                    {
-                        node = n;
-                        break;
-                    }
-                }
-            }
+            return stats;
+        }
 
-            if (node != nullptr)
+        bool process (int accumulatorSlot)
+        {
+            for (auto& slot : operations)
             {
-                op->processNode (node, buffer);
-                return true;
+                if (slot.op.load() == nullptr)
+                    continue;
+
+                ++slot.numUsers;
+                bool didWork = false;
+
+                if (auto op = slot.op.load())
+                    didWork = op->processNextNode (accumulatorSlot);
+
+                --slot.numUsers;
+
+                if (didWork)
+                    return true;
             }
 
             return false;
@@ -194,8 +348,9 @@ struct MultiCPU
         //==============================================================================
         struct MixerThread : public Thread
         {
-            MixerThread (MixerThreadPool& mt)
-               : Thread ("mixer"), owner (mt)
+            MixerThread (MixerThreadPool& mt, int slot)
+               : Thread ("mixer"), owner (mt), accumulatorSlot (slot),
+                 cpu (AudioWorkerThreads::getCPUForWorker (mt.threadOptions, slot - 1))
             {
                 startThread (Thread::realtimeAudioPriority);
             }
@@ -208,24 +363,47 @@ struct MultiCPU
             void run() override
             {
                 FloatVectorOperations::disableDenormalisedNumberSupport();
-                buffer.setSize (2, 1024);
+
+                if (! AudioWorkerThreads::configureCurrentThreadAsWorker (owner.threadOptions, accumulatorSlot - 1))
+                    TRACKTION_LOG_ERROR ("Unable to apply audio worker thread options to mixer thread " + String (accumulatorSlot));
 
                 while (! threadShouldExit())
                 {
-                    if (! owner.process (buffer))
-                        wait (1000);
+                    if (! owner.process (accumulatorSlot))
+                    {
+                        const double sleepStartMs = Time::getMillisecondCounterHiRes();
+
+                        if (wait (1000))
+                        {
+                            const double notifyTimeMs = owner.lastNotifyTimeMs.load (std::memory_order_relaxed);
+
+                            if (notifyTimeMs >= sleepStartMs)
+                                latency.addMeasurement (Time::getMillisecondCounterHiRes() - notifyTimeMs);
+                        }
+                    }
                 }
             }
 
-        private:
-            juce::AudioBuffer<float> buffer;
             MixerThreadPool& owner;
+            const int accumulatorSlot, cpu;
+            SchedulingLatency latency;
         };
 
-        CriticalSection opLock;
-        OwnedArray<MixerThread> threads;
+        //==============================================================================
+        /** An operation slot. A thread bumps numUsers before reading op so that
+            removeOperation() knows when it's safe for the operation to be destroyed.
+        */
+        struct OperationSlot
+        {
+            std::atomic<ParallelMixOperation*> op { nullptr };
+            std::atomic<int> numUsers { 0 };
+        };
 
-        LinkedListPointer<ParallelMixOperation> opList;
+        static constexpr int maxNumOperations = 64;
+        OperationSlot operations[maxNumOperations];
+        OwnedArray<MixerThread> threads;
+        AudioWorkerThreadOptions threadOptions;
+        std::atomic<double> lastNotifyTimeMs { 0.0 };
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MixerThreadPool)
     };
@@ -322,9 +500,31 @@ void MixerAudioNode::prepareAudioNodeToPlay (const PlaybackInitialisationInfo& i
     if (use64bitMixing)
         set64bitBufferSize (info.blockSizeSamples, jmax (2, maxNumberOfChannels));
 
+    auto numMixerThreads = MultiCPU::MixerThreadPool::getInstance()->threads.size();
+
     shouldUseMultiCpu = canUseMultiCpu
                          && inputs.size() > 1
-                         && MultiCPU::MixerThreadPool::getInstance()->threads.size() > 0;
+                         && numMixerThreads > 0;
+
+    if (shouldUseMultiCpu)
+        prepareAccumulators (numMixerThreads + 1, info.blockSizeSamples, jmax (2, maxNumberOfChannels));
+    else
+        accumulators.clear();
+
+    if (renderOrder.size() != (size_t) inputs.size())
+    {
+        inputCostsMs = std::vector<std::atomic<double>> ((size_t) inputs.size());
+        renderOrder.resize ((size_t) inputs.size());
+        std::iota (renderOrder.begin(), renderOrder.end(), 0);
+    }
+}
+
+double MixerAudioNode::getInputCostMs (int inputIndex) const
+{
+    if (isPositiveAndBelow (inputIndex, (int) inputCostsMs.size()))
+        return inputCostsMs[(size_t) inputIndex].load (std::memory_order_relaxed);
+
+    return 0.0;
 }
 
 bool MixerAudioNode::isReadyToRender()
@@ -346,33 +546,8 @@ void MixerAudioNode::multiCpuRender (const AudioRenderContext& rc)
 {
     if ((hasAudio || hasMidi) && inputs.size() > 0)
     {
-        MultiCPU::ParallelMixOperation parallelOp (rc, inputs);
-
-        parallelOp.buffer64 = nullptr;
-
-        if (use64bitMixing && rc.destBuffer != nullptr)
-        {
-            set64bitBufferSize (rc.bufferNumSamples, jmax (2, rc.destBuffer->getNumChannels()));
-
-            parallelOp.buffer64 = temp64bitBuffer.getArrayOfWritePointers();
-
-            for (int j = rc.destBuffer->getNumChannels(); --j >= 0;)
-            {
-                double* dest = parallelOp.buffer64[j];
-                const float* src = rc.destBuffer->getReadPointer (j, rc.bufferStartSample);
-
-                for (int i = 0; i < rc.bufferNumSamples; ++i)
-                     *dest++ = *src++;
-            }
-
-            parallelOp.perform();
-
-            MultiCPU::addDoublesToBuffer (rc, temp64bitBuffer);
-        }
-        else
-        {
-            parallelOp.perform();
-        }
+        MultiCPU::ParallelMixOperation parallelOp (rc, *this);
+        parallelOp.perform();
     }
 }
 
@@ -447,11 +622,44 @@ void MixerAudioNode::set64bitBufferSize (int samples, int numChans)
         temp64bitBuffer.setSize (numChans, samples, false, false, true);
 }
 
+void MixerAudioNode::prepareAccumulators (int numSlots, int numSamples, int numChans)
+{
+    accumulators.removeRange (numSlots, accumulators.size());
+
+    while (accumulators.size() < numSlots)
+        accumulators.add (new Accumulator());
+
+    for (auto a : accumulators)
+    {
+        a->midi.reserve (64);
+        a->scratchMidi.reserve (64);
+
+        if (use64bitMixing)
+        {
+            a->buffer64.setSize (numChans, numSamples, false, false, true);
+            a->scratch.setSize (numChans, numSamples, false, false, true);
+        }
+        else
+        {
+            a->buffer.setSize (numChans, numSamples, false, false, true);
+        }
+    }
+}
+
 void MixerAudioNode::updateNumCPUs (Engine& e)
 {
     CRASH_TRACER
+    auto& behaviour = e.getEngineBehaviour();
     MultiCPU::MixerThreadPool::getInstance()
-        ->setNumThreads (e.getEngineBehaviour().getNumberOfCPUsToUseForAudio() - 1);
+        ->setNumThreads (behaviour.getNumberOfCPUsToUseForAudio() - 1, behaviour.getAudioWorkerThreadOptions());
+}
+
+std::vector<AudioWorkerThreads::WorkerStats> MixerAudioNode::getWorkerThreadStats()
+{
+    if (auto pool = MultiCPU::MixerThreadPool::getInstanceWithoutCreating())
+        return pool->getWorkerStats();
+
+    return {};
 }
 
 }
@@ -19,6 +19,12 @@ public:
 
     static void updateNumCPUs (Engine&);
 
+    /** Returns the CPU and scheduling latency of each of the shared mixer threads.
+        The latency is measured from the notify that woke a sleeping thread, so work a
+        thread picks up while it's still busy with the last job doesn't count towards it.
+    */
+    static std::vector<AudioWorkerThreads::WorkerStats> getWorkerThreadStats();
+
     //==============================================================================
     /** Adds an input node.
         This will be deleted by this node when no longer needed.
@@ -44,8 +50,33 @@ public:
     void renderAdding (const AudioRenderContext&) override;
     void prepareForNextBlock (const AudioRenderContext&) override;
 
+    //==============================================================================
+    /** Returns the number of inputs. */
+    int getNumInputs() const noexcept                           { return inputs.size(); }
+
+    /** Returns an input node. */
+    AudioNode* getInput (int index) const noexcept              { return inputs[index]; }
+
+    /** Returns the smoothed time in milliseconds an input takes to render.
+        This is only measured when mixing on multiple CPUs, where it's used to start
+        the most expensive inputs first.
+    */
+    double getInputCostMs (int inputIndex) const;
+
 private:
+    friend struct MultiCPU;
+
+    /** The running sum for one of the threads taking part in a multi-CPU render. */
+    struct Accumulator
+    {
+        juce::AudioBuffer<float> buffer, scratch;
+        juce::AudioBuffer<double> buffer64;
+        MidiMessageArray midi, scratchMidi;
+        bool isUsed = false;
+    };
+
     void multiCpuRender (const AudioRenderContext&);
+    void prepareAccumulators (int numSlots, int numSamples, int numChans);
 
     //==============================================================================
     juce::OwnedArray<AudioNode> inputs;
@@ -54,6 +85,9 @@ private:
     int maxNumberOfChannels = 0;
 
     juce::AudioBuffer<double> temp64bitBuffer;
+    juce::OwnedArray<Accumulator> accumulators;
+    std::vector<std::atomic<double>> inputCostsMs;
+    std::vector<int> renderOrder;
     const bool use64bitMixing;
     const bool canUseMultiCpu;
     bool shouldUseMultiCpu = false;
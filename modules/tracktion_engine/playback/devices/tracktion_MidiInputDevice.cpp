@@ -14,7 +14,7 @@ namespace tracktion_engine
 class MidiControllerParser  : private AsyncUpdater
 {
 public:
-    MidiControllerParser (Engine& e) : engine (e) {}
+    MidiControllerParser (Engine& e, MidiInputDevice& d) : engine (e), device (d) {}
 
     void processMessage (const MidiMessage& m)
     {
@@ -82,8 +82,15 @@ private:
     void controllerMoved (int number, int value, int channel)
     {
         {
-            const ScopedLock sl (pendingLock);
-            pendingMessages.add ({ number, channel, value / 127.0f });
+            // Messages can come from the MIDI thread or the message thread, so the
+            // writers take turns. The reader never has to wait.
+            const SpinLock::ScopedLockType sl (writerLock);
+
+            if (! pendingMessages.push (Message { number, channel, value / 127.0f }))
+            {
+                ++numDropped;
+                device.messageDropped();
+            }
         }
 
         triggerAsyncUpdate();
@@ -91,16 +98,15 @@ private:
 
     void handleAsyncUpdate() override
     {
-        Array<Message> messages;
-
-        {
-            const ScopedLock sl (pendingLock);
-            pendingMessages.swapWith (messages);
-        }
+        auto pcm = ParameterControlMappings::getCurrentlyFocusedMappings (engine);
+        Message m;
 
-        if (auto pcm = ParameterControlMappings::getCurrentlyFocusedMappings (engine))
-            for (const auto& m : messages)
+        while (pendingMessages.pop (m))
+            if (pcm != nullptr)
                 pcm->sendChange (m.controllerID, m.newValue, m.channel);
+
+        if (auto n = numDropped.exchange (0))
+            TRACKTION_LOG_ERROR ("Dropped " + String (n) + " controller messages from " + device.getName());
     }
 
     int lastParamNumber = 0;
@@ -115,8 +121,10 @@ private:
     };
 
     Engine& engine;
-    Array<Message> pendingMessages;
-    CriticalSection pendingLock;
+    MidiInputDevice& device;
+    LockFreeFifo<Message> pendingMessages { 1024 };
+    SpinLock writerLock;
+    std::atomic<int> numDropped { 0 };
 };
 
 //==============================================================================
@@ -402,8 +410,19 @@ void MidiInputDevice::updateRetrospectiveBufferLength (double length)
 }
 
 //==============================================================================
-void MidiInputDevice::addInstance (MidiInputDeviceInstanceBase* i)    { const ScopedLock sl (instanceLock); instances.addIfNotAlreadyThere (i); }
-void MidiInputDevice::removeInstance (MidiInputDeviceInstanceBase* i) { const ScopedLock sl (instanceLock); instances.removeAllInstancesOf (i); }
+void MidiInputDevice::addInstance (MidiInputDeviceInstanceBase* i)
+{
+    const ScopedLock sl (instanceLock);
+    const SpinLock::ScopedLockType sl2 (instanceListLock);
+    instances.addIfNotAlreadyThere (i);
+}
+
+void MidiInputDevice::removeInstance (MidiInputDeviceInstanceBase* i)
+{
+    const ScopedLock sl (instanceLock);
+    const SpinLock::ScopedLockType sl2 (instanceListLock);
+    instances.removeAllInstancesOf (i);
+}
 
 void MidiInputDevice::connectionStateChanged()
 {
@@ -1023,6 +1042,8 @@ public:
 
     void masterTimeUpdate (double time)
     {
+        blockStartTime = time;
+
         if (context.playhead.isPlaying())
         {
             pausedTime = 0;
@@ -1056,8 +1077,6 @@ private:
         InputAudioNode (MidiInputDeviceInstanceBase& m, MidiMessageArray::MPESourceID msi)
             : owner (m), midiSourceID (msi)
         {
-            for (int i = 256; --i >= 0;)
-                incomingMessages.add (new MidiMessage (0x80, 0, 0));
         }
 
         ~InputAudioNode() override
@@ -1085,25 +1104,17 @@ private:
         void prepareAudioNodeToPlay (const PlaybackInitialisationInfo& info) override
         {
             lastPlayheadTime = 0.0;
-            numMessages = 0;
             maxExpectedMsPerBuffer = (unsigned int) (((info.blockSizeSamples * 1000) / info.sampleRate) * 2 + 100);
-            auto& mi = getMidiInput();
-
-            {
-                const ScopedLock sl (bufferLock);
 
-                auto channelToUse = mi.getChannelToUse();
-                auto programToUse = mi.getProgramToUse();
-
-                if (channelToUse.isValid() && programToUse > 0)
-                    handleIncomingMidiMessage (MidiMessage::programChange (channelToUse.getChannelNumber(), programToUse - 1));
-            }
-
-            {
-                const ScopedLock sl (bufferLock);
-                liveRecordedMessages.clear();
-                numLiveMessagesToPlay = 0;
-            }
+            // Nothing else can use the queues until this has been (re-)added to the owner.
+            // The program change is sent by the first block, as it won't be contiguous.
+            owner.remove (this);
+            incomingMessages.reset();
+            liveMessages.reset();
+            liveRecordedMessages.clear();
+            liveRecordedMessages.reserve (maxLiveRecordedMessages);
+            numLiveMessagesToPlay = 0;
+            numDropped = 0;
 
             owner.add (this);
         }
@@ -1117,9 +1128,8 @@ private:
         {
             owner.remove (this);
 
-            const ScopedLock sl (bufferLock);
-            numMessages = 0;
-            numLiveMessagesToPlay = 0;
+            if (auto n = numDropped.exchange (0))
+                TRACKTION_LOG_ERROR ("Dropped " + String (n) + " messages from " + getMidiInput().getName());
         }
 
         void createProgramChanges (MidiMessageArray& bufferForMidiMessages)
@@ -1149,38 +1159,36 @@ private:
             {
                 const auto timeNow = Time::getApproximateMillisecondCounter();
 
-                const ScopedLock sl (bufferLock);
-
                 if (! rc.isContiguousWithPreviousBlock())
                     createProgramChanges (*rc.bufferForMidiMessages);
 
                 // if it's been a long time since the last block, clear the buffer because
                 // it means we were muted or glitching
                 if (timeNow > lastReadTime + maxExpectedMsPerBuffer)
-                {
-                    //jassertfalse
-                    numMessages = 0;
-                }
+                    incomingMessages.clear();
 
                 lastReadTime = timeNow;
 
-                jassert (numMessages <= incomingMessages.size());
+                // Each message was stamped on arrival with how far it was into the block being
+                // played at the time, so they keep their spacing a block later
+                const auto maxOffset = jmax (0.0, editTime.getLength());
 
-                if (int num = jmin (numMessages, incomingMessages.size()))
+                while (auto m = incomingMessages.peek())
                 {
-                    // not quite right as the first event won't be at the start of the buffer, but near enough for live stuff
-                    auto timeAdjust = incomingMessages.getUnchecked (0)->getTimeStamp();
-
-                    for (int i = 0; i < num; ++i)
-                    {
-                        auto* m = incomingMessages.getUnchecked (i);
-                        rc.bufferForMidiMessages->addMidiMessage (*m,
-                                                                  jlimit (0.0, jmax (0.0, editTime.getLength()), m->getTimeStamp() - timeAdjust),
-                                                                  midiSourceID);
-                    }
+                    rc.bufferForMidiMessages->addMidiMessage (*m, jlimit (0.0, maxOffset, m->getTimeStamp()), midiSourceID);
+                    incomingMessages.skip();
                 }
 
-                numMessages = 0;
+                // This is the audio thread, so the live recording can't grow beyond what was reserved
+                while (auto m = liveMessages.peek())
+                {
+                    if (liveRecordedMessages.size() < maxLiveRecordedMessages)
+                        liveRecordedMessages.addMidiMessage (*m, m->getTimeStamp(), midiSourceID);
+                    else
+                        messageDropped();
+
+                    liveMessages.skip();
+                }
 
                 if (lastPlayheadTime > editTime.getStart())
                     // when we loop, we can assume all the messages in here are now from the previous time round, so are playable
@@ -1196,8 +1204,6 @@ private:
                      && numLiveMessagesToPlay > 0
                      && rc.playhead.isPlaying())
                 {
-                    const ScopedLock sl2 (liveInputLock);
-
                     for (int i = 0; i < numLiveMessagesToPlay; ++i)
                     {
                         auto& m = liveRecordedMessages[i];
@@ -1216,18 +1222,13 @@ private:
             auto channelToUse = mi.getChannelToUse().getChannelNumber();
 
             {
-                const ScopedLock sl (bufferLock);
-
-                if (numMessages < incomingMessages.size())
-                {
-                    auto& m = *incomingMessages.getUnchecked (numMessages);
-                    m = message;
+                MidiMessage m (message, message.getTimeStamp() - owner.blockStartTime.load());
 
-                    if (channelToUse > 0)
-                        m.setChannel (channelToUse);
+                if (channelToUse > 0)
+                    m.setChannel (channelToUse);
 
-                    ++numMessages;
-                }
+                if (! incomingMessages.push (std::move (m)))
+                    messageDropped();
             }
 
             if (owner.livePlayOver)
@@ -1252,9 +1253,8 @@ private:
                     if (channelToUse > 0)
                         newMess.setChannel (channelToUse);
 
-                    const ScopedLock sl (liveInputLock);
-
-                    liveRecordedMessages.addMidiMessage (newMess, sourceTime, midiSourceID);
+                    if (! liveMessages.push (std::move (newMess)))
+                        messageDropped();
                 }
             }
         }
@@ -1262,15 +1262,23 @@ private:
         MidiInputDevice& getMidiInput() const noexcept   { return owner.getMidiInput(); }
 
     private:
+        void messageDropped() noexcept
+        {
+            ++numDropped;
+            getMidiInput().messageDropped();
+        }
+
         MidiInputDeviceInstanceBase& owner;
 
-        CriticalSection bufferLock;
-        OwnedArray<MidiMessage> incomingMessages;
-        int numMessages = 0;
+        // These are written by whichever thread is sending messages to the device's instances,
+        // which the device serialises, and read by the audio thread
+        LockFreeFifo<MidiMessage> incomingMessages { 1024 }, liveMessages { 1024 };
+
+        static constexpr int maxLiveRecordedMessages = 4096;
         MidiMessageArray liveRecordedMessages;
+        std::atomic<int> numDropped { 0 };
         int numLiveMessagesToPlay = 0; // the index of the first message that's been recorded in the current loop
         MidiMessageArray::MPESourceID midiSourceID = MidiMessageArray::notMPE;
-        CriticalSection liveInputLock;
         unsigned int lastReadTime = 0, maxExpectedMsPerBuffer = 0;
         double lastPlayheadTime = 0;
 
@@ -1279,6 +1287,7 @@ private:
 
     CriticalSection nodeLock;
     Array<InputAudioNode*> nodes;
+    std::atomic<double> blockStartTime { 0.0 };
     double lastEditTime = -1.0;
     double pausedTime = 0;
     MidiMessageArray::MPESourceID midiSourceID = MidiMessageArray::createUniqueMPESourceID();
@@ -1295,7 +1304,9 @@ void MidiInputDevice::masterTimeUpdate (double time)
 {
     adjustSecs = time - Time::getMillisecondCounterHiRes() * 0.001;
 
-    const ScopedLock sl (instanceLock);
+    // This is called by the audio thread, so mustn't wait for instanceLock while
+    // the MIDI thread is busy passing a message on
+    const SpinLock::ScopedLockType sl (instanceListLock);
 
     for (auto instance : instances)
         instance->masterTimeUpdate (time);
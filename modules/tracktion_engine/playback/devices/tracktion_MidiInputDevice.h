@@ -88,6 +88,14 @@ public:
 
     MidiChannel getMidiChannelFor (int rawChannelNumber) const;
 
+    /** Returns the number of incoming messages that have been dropped because they
+        arrived faster than the audio or message thread could take them.
+    */
+    int getNumMessagesDropped() const noexcept      { return numMessagesDropped.load(); }
+
+    /** @internal */
+    void messageDropped() noexcept                  { numMessagesDropped.fetch_add (1, std::memory_order_relaxed); }
+
     //==============================================================================
     /** Gets notified (lazily, not in real-time) when any MidiInputDevice's key's state changes. */
     struct MidiKeyChangeDispatcher
@@ -111,6 +119,7 @@ protected:
     class MidiEventSnifferNode;
 
     std::atomic<double> adjustSecs { 0 };
+    std::atomic<int> numMessagesDropped { 0 };
     double manualAdjustMs = 0;
     bool overrideNoteVels = false, eventReceivedFromDevice = false;
     juce::BigInteger disallowedChannels;
@@ -124,6 +133,7 @@ protected:
     juce::SharedResourcePointer<MidiKeyChangeDispatcher> midiKeyChangeDispatcher;
 
     juce::CriticalSection instanceLock;
+    juce::SpinLock instanceListLock; // also held while the list changes, for the audio thread
     juce::Array<MidiInputDeviceInstanceBase*> instances;
     std::unique_ptr<RetrospectiveMidiBuffer> retrospectiveBuffer;
 
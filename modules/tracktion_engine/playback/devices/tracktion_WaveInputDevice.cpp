@@ -115,85 +115,207 @@ static String expandPatterns (Edit& ed, const String& s, Track* track, int take)
 
 
 //==============================================================================
-struct RetrospectiveRecordBuffer
+/** Keeps the last few seconds of a device's input.
+
+    Each channel has a fixed stretch of one big allocation that's written round in a
+    ring. The memory is only allocated on the message thread, and the OS doesn't commit
+    the pages until they're first written. A take swaps the ring for an empty one with
+    the audio thread locked out, and the old ring is then written to disk as it is, so
+    every track it's written to gets the same audio.
+*/
+struct RetrospectiveRecordBuffer  : private juce::AsyncUpdater
 {
-    RetrospectiveRecordBuffer (Engine& e)
+private:
+    struct Ring
     {
-        lengthInSeconds = e.getPropertyStorage().getProperty (SettingID::retrospectiveRecord, 30);
-    }
+        Ring (int numChannelsToUse, int numSamplesToUse, double rate)
+            : numChannels (numChannelsToUse), numSamples (numSamplesToUse), sampleRate (rate),
+              data ((size_t) numChannelsToUse * (size_t) numSamplesToUse)
+        {
+            for (int i = 0; i < numChannels; ++i)
+                channels.add (data.get() + (size_t) i * (size_t) numSamples);
+        }
 
-    void updateSizeIfNeeded (int newNumChannels, double newSampleRate)
-    {
-        int newNumSamples = roundToInt (lengthInSeconds * newSampleRate);
+        void write (const juce::AudioBuffer<float>& source, int num) noexcept
+        {
+            auto pos = (int) (numWritten % numSamples);
+            auto numBeforeWrap = jmin (num, numSamples - pos);
+
+            for (int i = 0; i < numChannels; ++i)
+            {
+                auto src = source.getReadPointer (i);
+                FloatVectorOperations::copy (channels.getUnchecked (i) + pos, src, numBeforeWrap);
+                FloatVectorOperations::copy (channels.getUnchecked (i), src + numBeforeWrap, num - numBeforeWrap);
+            }
+
+            numWritten += num;
+        }
+
+        int getNumAvailable() const noexcept
+        {
+            return (int) jmin ((juce::int64) numSamples, numWritten.load());
+        }
 
-        if (newNumChannels != numChannels || newNumSamples != numSamples || newSampleRate != sampleRate)
+        /** Appends a section of the ring to a file without copying it anywhere else first. */
+        bool appendTo (AudioFileWriter& writer, int start, int num) const
         {
-            numChannels = newNumChannels;
-            numSamples  = newNumSamples;
-            sampleRate  = newSampleRate;
+            if (num <= 0)
+                return true;
 
-            fifo.setSize (numChannels, jmax (1, numSamples));
-            fifo.reset();
+            juce::AudioBuffer<float> section (channels.begin(), numChannels, start, num);
+            return writer.appendBuffer (section, num);
         }
+
+        const int numChannels, numSamples;
+        const double sampleRate;
+        juce::HeapBlock<float> data;
+        juce::Array<float*> channels;
+        std::atomic<juce::int64> numWritten { 0 };
+    };
+
+public:
+    RetrospectiveRecordBuffer (Engine& e)
+        : engine (e)
+    {
+        lengthInSeconds = e.getPropertyStorage().getProperty (SettingID::retrospectiveRecord, 30);
     }
 
-    void processBuffer (double streamTime, const juce::AudioBuffer<float>& inputBuffer, int numSamplesIn)
+    ~RetrospectiveRecordBuffer() override
     {
-        if (numSamplesIn < numSamples)
-        {
-            lastStreamTime = streamTime;
+        cancelPendingUpdate();
+    }
 
-            fifo.ensureFreeSpace (numSamplesIn);
-            fifo.write (inputBuffer);
-        }
+    /** Allocates the ring for an input. This must be called on the message thread. */
+    void prepare (int newNumChannels, double newSampleRate)
+    {
+        wantedNumChannels = newNumChannels;
+        wantedSampleRate = newSampleRate;
+        reallocateIfNeeded();
     }
 
-    void syncToEdit (Edit& edit, EditPlaybackContext& context, double streamTime, int numSamplesIn)
+    /** Changes the length of the ring. This must be called on the message thread. */
+    void setLength (double seconds)
     {
-        auto& pei = editInfo[edit.getProjectItemID()];
+        lengthInSeconds = seconds;
+        reallocateIfNeeded();
+    }
 
-        if (context.playhead.isPlaying())
+    /** Adds a block from the audio thread. If the ring doesn't match the input, the block
+        is skipped and the message thread is asked to reallocate it.
+    */
+    void processBuffer (double streamTime, const juce::AudioBuffer<float>& inputBuffer,
+                        int numSamplesIn, double currentSampleRate)
+    {
+        if (ring == nullptr
+             || ring->numChannels != inputBuffer.getNumChannels()
+             || ring->sampleRate != currentSampleRate)
         {
-            pei.pausedTime = 0;
-            pei.lastEditTime = context.playhead.streamTimeToSourceTime (streamTime);
+            wantedNumChannels = inputBuffer.getNumChannels();
+            wantedSampleRate = currentSampleRate;
+            triggerAsyncUpdate();
+            return;
         }
-        else
+
+        if (numSamplesIn < ring->numSamples)
         {
-            pei.pausedTime += numSamplesIn / sampleRate;
+            lastStreamTime = streamTime;
+            ring->write (inputBuffer, numSamplesIn);
         }
     }
 
-    bool wasRecentlyPlaying (Edit& edit)
+    /** The ring as it was when a take was grabbed. */
+    struct Take
     {
-        auto& pei = editInfo[edit.getProjectItemID()];
+        double sampleRate = 0, lastStreamTime = 0;
 
-        return (pei.lastEditTime >= 0 && pei.pausedTime < 20);
-    }
+        int getNumChannels() const noexcept     { return ring != nullptr ? ring->numChannels : 0; }
+        int getNumSamples() const noexcept      { return numSamples; }
+
+        /** Appends the audio to a file, oldest first. */
+        bool writeTo (AudioFileWriter& writer) const
+        {
+            if (ring == nullptr)
+                return true;
+
+            auto start = (int) ((numWritten - numSamples) % ring->numSamples);
+            auto numBeforeWrap = jmin (numSamples, ring->numSamples - start);
+
+            return ring->appendTo (writer, start, numBeforeWrap)
+                    && ring->appendTo (writer, 0, numSamples - numBeforeWrap);
+        }
+
+    private:
+        friend struct RetrospectiveRecordBuffer;
+        std::unique_ptr<Ring> ring;
+        juce::int64 numWritten = 0;
+        int numSamples = 0;
+    };
 
-    void removeEditSync (Edit& edit)
+    /** Hands over everything in the ring and carries on with an empty one.
+        This must be called on the message thread. Only the swap is done with the audio
+        callback locked, and the old ring isn't touched by the audio thread after that.
+    */
+    Take takeContents()
     {
-        auto itr = editInfo.find (edit.getProjectItemID());
+        TRACKTION_ASSERT_MESSAGE_THREAD
+        Take take;
+
+        if (ring == nullptr)
+            return take;
+
+        // The ring only changes on this thread so its replacement can be allocated before locking
+        std::unique_ptr<Ring> newRing (new Ring (ring->numChannels, ring->numSamples, ring->sampleRate));
+
+        {
+            const ScopedLock sl (engine.getDeviceManager().deviceManager.getAudioCallbackLock());
+            std::swap (ring, newRing);
+            take.lastStreamTime = lastStreamTime;
+        }
 
-        if (itr != editInfo.end())
-            editInfo.erase (itr);
+        take.ring = std::move (newRing);
+        take.sampleRate = take.ring->sampleRate;
+        take.numWritten = take.ring->numWritten.load();
+        take.numSamples = take.ring->getNumAvailable();
+        return take;
     }
 
-    double lengthInSeconds = 30.0;
+    bool isEmpty() const noexcept           { return ring == nullptr || ring->numWritten.load() == 0; }
+    int getNumChannels() const noexcept     { return ring != nullptr ? ring->numChannels : 0; }
+    double getSampleRate() const noexcept   { return ring != nullptr ? ring->sampleRate : 0.0; }
 
-    AudioFifo fifo { 1, 1 };
+    double lengthInSeconds = 30.0;
     double lastStreamTime = 0;
 
-    int numChannels = 0;
-    int numSamples = 0;
-    double sampleRate = 0;
+private:
+    Engine& engine;
+    std::unique_ptr<Ring> ring;
+    std::atomic<int> wantedNumChannels { 0 };
+    std::atomic<double> wantedSampleRate { 0.0 };
 
-    struct PerEditInfo
+    void reallocateIfNeeded()
     {
-        double lastEditTime = -1;
-        double pausedTime = 0;
-    };
+        TRACKTION_ASSERT_MESSAGE_THREAD
+        auto numChannels = wantedNumChannels.load();
+        auto sampleRate = wantedSampleRate.load();
+        auto numSamples = jmax (1, roundToInt (lengthInSeconds * sampleRate));
+
+        if (numChannels <= 0 || sampleRate <= 0
+             || (ring != nullptr && ring->numChannels == numChannels
+                  && ring->numSamples == numSamples && ring->sampleRate == sampleRate))
+            return;
+
+        std::unique_ptr<Ring> newRing (new Ring (numChannels, numSamples, sampleRate));
+
+        {
+            const ScopedLock sl (engine.getDeviceManager().deviceManager.getAudioCallbackLock());
+            std::swap (ring, newRing);
+        }
+    }
 
-    std::map<ProjectItemID, PerEditInfo> editInfo;
+    void handleAsyncUpdate() override
+    {
+        reallocateIfNeeded();
+    }
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RetrospectiveRecordBuffer)
 };
@@ -212,12 +334,6 @@ public:
     ~WaveInputDeviceInstance() override
     {
         stop();
-
-        auto& wi = getWaveInput();
-
-        if (wi.retrospectiveBuffer)
-            wi.retrospectiveBuffer->removeEditSync (edit);
-
         getWaveInput().removeInstance (this);
     }
 
@@ -845,15 +961,24 @@ public:
     juce::Array<Clip*> applyRetrospectiveRecord (SelectionManager* selectionManager) override
     {
         juce::Array<Clip*> clips;
-        
-        for (auto dstTrack : getTargetTracks())
-        {
-            auto& wi = getWaveInput();
+        auto& wi = getWaveInput();
+        auto recordBuffer = wi.getRetrospectiveRecordBuffer();
+
+        if (recordBuffer == nullptr || recordBuffer->isEmpty())
+            return clips;
 
-            auto recordBuffer = wi.getRetrospectiveRecordBuffer();
+        // Each target track gets a file written from this one copy
+        auto take = recordBuffer->takeContents();
 
-            if (recordBuffer == nullptr)
-                return nullptr;
+        if (take.getNumSamples() == 0)
+            return clips;
+
+        const bool wasRecentlyPlaying = lastEditTime >= 0 && pausedTime < 20;
+        const double editTimeWhenStopped = lastEditTime + pausedTime;
+        lastEditTime = -1;
+
+        for (auto dstTrack : getTargetTracks())
+        {
 
             auto format = getFormatToUse();
             File recordedFile;
@@ -867,24 +992,11 @@ public:
 
             {
                 AudioFileWriter writer (AudioFile (dstTrack->edit.engine, recordedFile), format,
-                                        recordBuffer->numChannels,
-                                        recordBuffer->sampleRate,
+                                        take.getNumChannels(), take.sampleRate,
                                         wi.bitDepth, metadata, 0);
 
-                if (writer.isOpen())
-                {
-                    int numReady;
-                    juce::AudioBuffer<float> scratchBuffer (recordBuffer->numChannels, 1000);
-
-                    while ((numReady = recordBuffer->fifo.getNumReady()) > 0)
-                    {
-                        auto toRead = jmin (numReady, scratchBuffer.getNumSamples());
-
-                        if (! recordBuffer->fifo.read (scratchBuffer, 0, toRead)
-                             || ! writer.appendBuffer (scratchBuffer, toRead))
-                            return nullptr;
-                    }
-                }
+                if (writer.isOpen() && ! take.writeTo (writer))
+                    return nullptr;
             }
 
             auto proj = owner.engine.getProjectManager().getProject (edit);
@@ -908,19 +1020,17 @@ public:
             double start = 0;
             double recordedLength = AudioFile (dstTrack->edit.engine, recordedFile).getLength();
 
-            if (context.playhead.isPlaying() || recordBuffer->wasRecentlyPlaying (edit))
+            if (context.playhead.isPlaying() || wasRecentlyPlaying)
             {
                 auto adjust = -wi.getAdjustmentSeconds() + edit.engine.getDeviceManager().getBlockSizeMs() / 1000.0;
 
                 if (context.playhead.isPlaying())
                 {
-                    start = context.playhead.streamTimeToSourceTime (recordBuffer->lastStreamTime) - recordedLength + adjust;
+                    start = context.playhead.streamTimeToSourceTime (take.lastStreamTime) - recordedLength + adjust;
                 }
                 else
                 {
-                    auto& pei = recordBuffer->editInfo[edit.getProjectItemID()];
-                    start = pei.lastEditTime + pei.pausedTime - recordedLength + adjust;
-                    pei.lastEditTime = -1;
+                    start = editTimeWhenStopped - recordedLength + adjust;
                 }
             }
             else
@@ -948,7 +1058,7 @@ public:
 
             CRASH_TRACER
 
-            AudioFileUtils::applyBWAVStartTime (recordedFile, (int64) (newClip->getPosition().getStartOfSource() * recordBuffer->sampleRate));
+            AudioFileUtils::applyBWAVStartTime (recordedFile, (int64) (newClip->getPosition().getStartOfSource() * take.sampleRate));
             edit.engine.getAudioFileManager().forceFileUpdate (AudioFile (dstTrack->edit.engine, recordedFile));
 
             if (selectionManager != nullptr)
@@ -1015,14 +1125,20 @@ public:
 
         if (retrospectiveBuffer != nullptr)
         {
+            auto sampleRate = edit.engine.getDeviceManager().getSampleRate();
+
             if (addToRetrospective)
+                retrospectiveBuffer->processBuffer (streamTime, inputBuffer, numSamples, sampleRate);
+
+            if (context.playhead.isPlaying())
             {
-                retrospectiveBuffer->updateSizeIfNeeded (inputBuffer.getNumChannels(),
-                                                         edit.engine.getDeviceManager().getSampleRate());
-                retrospectiveBuffer->processBuffer (streamTime, inputBuffer, numSamples);
+                pausedTime = 0;
+                lastEditTime = context.playhead.streamTimeToSourceTime (streamTime);
+            }
+            else
+            {
+                pausedTime += numSamples / sampleRate;
             }
-
-            retrospectiveBuffer->syncToEdit (edit, context, streamTime, numSamples);
         }
 
         {
@@ -1104,6 +1220,7 @@ protected:
 
     volatile bool muteTrackNow = false;
     juce::AudioBuffer<float> inputBuffer;
+    double lastEditTime = -1.0, pausedTime = 0; // for placing retrospective takes
 
     void addBlockToRecord (const juce::AudioBuffer<float>& buffer, int start, int numSamples)
     {
@@ -1313,7 +1430,10 @@ StringArray WaveInputDevice::getRecordFormatNames()
 InputDeviceInstance* WaveInputDevice::createInstance (EditPlaybackContext& ed)
 {
     if (! isTrackDevice() && retrospectiveBuffer == nullptr)
+    {
         retrospectiveBuffer.reset (new RetrospectiveRecordBuffer (ed.edit.engine));
+        retrospectiveBuffer->prepare (getChannelSet().size(), engine.getDeviceManager().getSampleRate());
+    }
 
     return new WaveInputDeviceInstance (*this, ed);
 }
@@ -1706,149 +1826,596 @@ AudioNode* WaveInputDevice::createWaveInputDeviceNode (AudioNode* input)
 void WaveInputDevice::updateRetrospectiveBufferLength (double length)
 {
     if (retrospectiveBuffer != nullptr)
-        retrospectiveBuffer->lengthInSeconds = length;
+        retrospectiveBuffer->setLength (length);
 }
 
 //==============================================================================
+/*  A fixed ring of preallocated blocks that any number of audio threads can add to
+    and the recording thread reads from. Each slot's sequence number says whose turn
+    it is: a writer can fill slot n when it equals n, and the reader can take it once
+    it's n + 1. Releasing it sets it to n + the number of slots, ready for the next lap.
+
+    When a block can't be queued, its length is added to a running total for its
+    writer, and each block carries the total at the time it was queued. That tells
+    the reader how much silence to write before it to keep the file in time.
+*/
 struct WaveInputRecordingThread::BlockQueue
 {
-    BlockQueue()
+    BlockQueue (int numBlocks, int numChannels, int blockSize)
+        : blocks ((size_t) numBlocks),
+          maxNumChannels (numChannels), maxNumSamples (blockSize)
     {
-        for (int i = 32; --i >= 0;)
-            addToFreeQueue (new QueuedBlock());
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            blocks[i].sequence = (juce::uint64) i;
+            blocks[i].buffer.setSize (numChannels, blockSize);
+        }
     }
 
     struct QueuedBlock
     {
         QueuedBlock() = default;
 
-        void load (AudioFileWriter& w, const juce::AudioBuffer<float>& newBuffer,
-                   int start, int numSamples, const RecordingThumbnailManager::Thumbnail::Ptr& thumb)
+        std::atomic<juce::uint64> sequence { 0 };
+        AudioFileWriter* writer = nullptr;
+        juce::int64 samplesDroppedBefore = 0;
+        juce::AudioBuffer<float> buffer;
+        RecordingThumbnailManager::Thumbnail::Ptr thumbnail;
+
+        JUCE_DECLARE_NON_COPYABLE (QueuedBlock)
+    };
+
+    std::vector<QueuedBlock> blocks;
+    const int maxNumChannels, maxNumSamples;
+
+    std::atomic<juce::uint64> numQueued { 0 }, numFinished { 0 };
+    std::atomic<juce::int64> numDropped { 0 };
+    juce::uint64 readPosition = 0;  // only used by the reader
+
+    struct DroppedSamples
+    {
+        std::atomic<AudioFileWriter*> writer { nullptr };
+        std::atomic<juce::int64> numSamples { 0 };
+    };
+
+    // Slots are taken in order and only given up when nothing's recording
+    static constexpr int maxWritersWithDrops = 64;
+    std::array<DroppedSamples, maxWritersWithDrops> droppedSamples;
+    std::atomic<bool> anyDropped { false };
+
+    JUCE_DECLARE_NON_COPYABLE (BlockQueue)
+
+    //==============================================================================
+    /** Returns the total length of a writer's blocks that have been dropped so far. */
+    juce::int64 getSamplesDropped (AudioFileWriter& w) noexcept
+    {
+        if (anyDropped.load (std::memory_order_acquire))
+            if (auto d = findDroppedSamples (w, false))
+                return d->numSamples.load (std::memory_order_relaxed);
+
+        return 0;
+    }
+
+    /** Called by a writer's audio thread when one of its blocks couldn't be queued. */
+    void addDroppedSamples (AudioFileWriter& w, int numSamples) noexcept
+    {
+        numDropped.fetch_add (1, std::memory_order_relaxed);
+
+        // If every slot's taken, the block is still counted but can't be made up for
+        if (auto d = findDroppedSamples (w, true))
         {
-            buffer.setSize (newBuffer.getNumChannels(), numSamples);
+            d->numSamples.fetch_add (numSamples, std::memory_order_relaxed);
+            anyDropped.store (true, std::memory_order_release);
+        }
+    }
 
-            for (int i = buffer.getNumChannels(); --i >= 0;)
-                buffer.copyFrom (i, 0, newBuffer, i, start, numSamples);
+    /** Called once all of a writer's audio has been written, so that another writer
+        that ends up at the same address doesn't inherit its drops.
+    */
+    void resetDroppedSamples (AudioFileWriter& w) noexcept
+    {
+        if (auto d = findDroppedSamples (w, false))
+            d->numSamples = 0;
+    }
 
-            writer = &w;
-            thumbnail = thumb;
+    /** This must only be called when nothing is recording. */
+    void clearDroppedSamples() noexcept
+    {
+        for (auto& d : droppedSamples)
+        {
+            d.writer = nullptr;
+            d.numSamples = 0;
         }
 
-        std::atomic<AudioFileWriter*> writer { nullptr };
-        QueuedBlock* next = nullptr;
-        juce::AudioBuffer<float> buffer { 2, 512 };
-        RecordingThumbnailManager::Thumbnail::Ptr thumbnail;
+        anyDropped = false;
+        numDropped = 0;
+    }
 
-        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (QueuedBlock)
-    };
+    DroppedSamples* findDroppedSamples (AudioFileWriter& w, bool createIfNeeded) noexcept
+    {
+        for (auto& d : droppedSamples)
+        {
+            auto current = d.writer.load (std::memory_order_acquire);
+
+            if (current == &w)
+                return &d;
 
-    CriticalSection freeQueueLock, pendingQueueLock;
-    QueuedBlock* firstPending = nullptr;
-    QueuedBlock* lastPending = nullptr;
-    QueuedBlock* firstFree = nullptr;
-    std::atomic<int> numPending { 0 };
+            if (current == nullptr)
+            {
+                if (! createIfNeeded)
+                    return nullptr;
 
-    QueuedBlock* findFreeBlock()
+                if (d.writer.compare_exchange_strong (current, &w) || current == &w)
+                    return &d;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //==============================================================================
+    /** Copies a block into the next free slot. This never allocates or waits, and
+        returns false if the queue is full.
+    */
+    bool push (AudioFileWriter& w, const juce::AudioBuffer<float>& source, int start, int numSamples,
+               juce::int64 samplesDroppedBefore, const RecordingThumbnailManager::Thumbnail::Ptr& thumbnail) noexcept
     {
-        const ScopedLock sl (freeQueueLock);
+        jassert (numSamples <= maxNumSamples);
+
+        if (source.getNumChannels() > maxNumChannels)
+            return false;
+
+        auto pos = numQueued.load (std::memory_order_relaxed);
+
+        for (;;)
+        {
+            auto& block = blocks[(size_t) (pos % blocks.size())];
+            auto diff = (juce::int64) (block.sequence.load (std::memory_order_acquire) - pos);
+
+            if (diff == 0)
+            {
+                if (numQueued.compare_exchange_weak (pos, pos + 1, std::memory_order_relaxed))
+                {
+                    block.buffer.setSize (source.getNumChannels(), numSamples, false, false, true);
 
-        if (firstFree == nullptr)
-            return new QueuedBlock();
+                    for (int i = source.getNumChannels(); --i >= 0;)
+                        block.buffer.copyFrom (i, 0, source, i, start, numSamples);
 
-        auto* b = firstFree;
-        firstFree = b->next;
-        b->next = nullptr;
-        return b;
+                    block.writer = &w;
+                    block.samplesDroppedBefore = samplesDroppedBefore;
+                    block.thumbnail = thumbnail;
+                    block.sequence.store (pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = numQueued.load (std::memory_order_relaxed);
+            }
+        }
     }
 
-    void addToFreeQueue (QueuedBlock* b) noexcept
+    /** Returns one of the blocks waiting to be written, or nullptr if it hasn't been
+        filled yet. Index 0 is the oldest block that hasn't been released.
+    */
+    QueuedBlock* getPendingBlock (int index) noexcept
     {
-        jassert (b != nullptr);
-        const ScopedLock sl (freeQueueLock);
-        b->writer = nullptr;
-        b->next = firstFree;
-        firstFree = b;
+        auto pos = readPosition + (juce::uint64) index;
+        auto& block = blocks[(size_t) (pos % blocks.size())];
+
+        if (block.sequence.load (std::memory_order_acquire) == pos + 1)
+            return &block;
+
+        return nullptr;
     }
 
-    void addToPendingQueue (QueuedBlock* b) noexcept
+    /** Hands the oldest blocks back to the writers. */
+    void releaseBlocks (int num) noexcept
     {
-        jassert (b != nullptr);
-        b->next = nullptr;
-        const ScopedLock sl (pendingQueueLock);
+        for (int i = 0; i < num; ++i)
+        {
+            auto& block = blocks[(size_t) (readPosition % blocks.size())];
+            block.writer = nullptr;
+            block.thumbnail = nullptr;
+            block.sequence.store (readPosition + blocks.size(), std::memory_order_release);
+            ++readPosition;
+        }
 
-        if (lastPending != nullptr)
-            lastPending->next = b;
-        else
-            firstPending = b;
+        numFinished.store (readPosition, std::memory_order_release);
+    }
+
+    void discardPendingBlocks() noexcept
+    {
+        while (getPendingBlock (0) != nullptr)
+            releaseBlocks (1);
+    }
 
-        lastPending = b;
-        ++numPending;
+    int getNumPending() const noexcept
+    {
+        return (int) (numQueued.load (std::memory_order_relaxed) - numFinished.load (std::memory_order_relaxed));
     }
+};
 
-    QueuedBlock* removeFirstPending() noexcept
+//==============================================================================
+/*  Keeps the numbers for one file being recorded and, on Linux, reserves its disk
+    space ahead of the writes and pushes what's been written out of the OS cache.
+*/
+struct WaveInputRecordingThread::FileState
+{
+    FileState (AudioFileWriter& w, int threadIndex, bool preallocate, bool bypassCache)
     {
-        const ScopedLock sl (pendingQueueLock);
+        stats.file = w.file.getFile();
+        stats.threadIndex = threadIndex;
+        bytesPerSample = jmax (1, w.getNumChannels() * w.getBitsPerSample() / 8);
 
-        if (auto b = firstPending)
+       #if JUCE_LINUX
+        shouldPreallocate = preallocate;
+        shouldBypassCache = bypassCache;
+
+        if (preallocate || bypassCache)
         {
-            firstPending = b->next;
+            fd = ::open (stats.file.getFullPathName().toRawUTF8(), O_WRONLY | O_CLOEXEC);
 
-            if (firstPending == nullptr)
-                lastPending = nullptr;
+            // The format writer has already written its header, so the audio starts after it
+            struct stat info;
 
-            --numPending;
-            return b;
+            if (fd >= 0 && ::fstat (fd, &info) == 0)
+                headerBytes = bytesReserved = bytesSynced = (juce::int64) info.st_size;
         }
+       #else
+        ignoreUnused (preallocate, bypassCache);
+       #endif
+    }
 
-        return {};
+    ~FileState()
+    {
+        finish();
+    }
+
+    /** Returns a copy of the stats. This can be called from any thread. */
+    WriterStats getStats() const
+    {
+        const SpinLock::ScopedLockType sl (statsLock);
+        return stats;
+    }
+
+    void addWrite (int numSamples, double writeMs, int queueDepth)
+    {
+        numSamplesWritten += numSamples;
+
+        {
+            const SpinLock::ScopedLockType sl (statsLock);
+            ++stats.numWrites;
+            stats.numSamplesWritten = numSamplesWritten;
+            stats.averageWriteMs += (writeMs - stats.averageWriteMs) / (double) stats.numWrites;
+            stats.maxWriteMs = jmax (stats.maxWriteMs, writeMs);
+            stats.queueDepth = queueDepth;
+        }
+
+       #if JUCE_LINUX
+        if (fd < 0)
+            return;
+
+        auto bytesWritten = headerBytes + numSamplesWritten * bytesPerSample;
+
+        if (shouldPreallocate && bytesWritten + preallocationChunk / 2 > bytesReserved)
+        {
+            // The file's length isn't changed, so the format writer is none the wiser
+            if (::fallocate (fd, FALLOC_FL_KEEP_SIZE, (off_t) bytesReserved, (off_t) preallocationChunk) == 0)
+                bytesReserved += preallocationChunk;
+            else
+                shouldPreallocate = false;
+        }
+
+        if (shouldBypassCache && bytesWritten - bytesSynced >= syncChunk)
+        {
+            // Start writing the latest chunk, and drop the one before it from the cache,
+            // which will have reached the disk by now
+            ::sync_file_range (fd, (off_t) bytesSynced, (off_t) (bytesWritten - bytesSynced), SYNC_FILE_RANGE_WRITE);
+
+            if (bytesSynced > headerBytes)
+                ::posix_fadvise (fd, 0, (off_t) bytesSynced, POSIX_FADV_DONTNEED);
+
+            bytesSynced = bytesWritten;
+        }
+       #endif
     }
 
-    void moveAnyPendingBlocksToFree() noexcept
+    void addSilence (juce::int64 numSamples)
     {
-        while (auto b = removeFirstPending())
-            addToFreeQueue (b);
+        silenceWritten += numSamples;
 
-        jassert (numPending == 0);
-        numPending = 0;
+        const SpinLock::ScopedLockType sl (statsLock);
+        stats.numSamplesDropped += numSamples;
     }
 
-    bool isWriterInQueue (AudioFileWriter& writer) const
+    void finish()
     {
-        const ScopedLock sl (pendingQueueLock);
+        {
+            const SpinLock::ScopedLockType sl (statsLock);
+            stats.finished = true;
+        }
 
-        for (auto b = firstPending; b != nullptr; b = b->next)
-            if (b->writer == &writer)
-                return true;
+       #if JUCE_LINUX
+        if (fd >= 0)
+        {
+            // Hands back any space that was reserved but not used
+            struct stat info;
 
-        return false;
+            if (bytesReserved > headerBytes && ::fstat (fd, &info) == 0)
+                ignoreUnused (::ftruncate (fd, info.st_size));
+
+            ::close (fd);
+            fd = -1;
+        }
+       #endif
+    }
+
+    // Only the thread writing the file changes the stats, but anything can read them
+    WriterStats stats;
+    juce::SpinLock statsLock;
+
+    juce::int64 bytesPerSample = 1, numSamplesWritten = 0;
+    juce::int64 silenceWritten = 0;
+
+   #if JUCE_LINUX
+    static constexpr juce::int64 preallocationChunk = 64 * 1024 * 1024, syncChunk = 8 * 1024 * 1024;
+    int fd = -1;
+    bool shouldPreallocate = false, shouldBypassCache = false;
+    juce::int64 headerBytes = 0, bytesReserved = 0, bytesSynced = 0;
+   #endif
+
+    JUCE_DECLARE_NON_COPYABLE (FileState)
+};
+
+//==============================================================================
+struct WaveInputRecordingThread::WriterThread  : public juce::Thread
+{
+    WriterThread (WaveInputRecordingThread& o, int index, int numBlocks, int numChannels, int blockSize)
+        : Thread ("WaveInputRecordingThread " + String (index + 1)),
+          owner (o), threadIndex (index), queue (numBlocks, numChannels, blockSize)
+    {
+    }
+
+    ~WriterThread() override
+    {
+        flushAndStop();
+    }
+
+    void flushAndStop()
+    {
+        signalThreadShouldExit();
+        notify();
+        stopThread (30000);
+        queue.discardPendingBlocks();
+    }
+
+    void run() override
+    {
+        CRASH_TRACER
+        FloatVectorOperations::disableDenormalisedNumberSupport();
+
+        for (;;)
+        {
+            if (queue.numDropped.load (std::memory_order_relaxed) > 0 && ! owner.hasWarned.exchange (true))
+                TRACKTION_LOG_ERROR ("Audio recording can't keep up!");
+
+            int numBlocks = 0;
+
+            while (numBlocks < maxBlocksPerBatch && queue.getPendingBlock (numBlocks) != nullptr)
+                ++numBlocks;
+
+            if (numBlocks > 0)
+            {
+                writeBlocks (numBlocks);
+                queue.releaseBlocks (numBlocks);
+            }
+            else
+            {
+                if (threadShouldExit())
+                    break;
+
+                // The audio thread doesn't wake this up, as that could mean waiting for a lock,
+                // so it polls. Waiting a little also means bigger writes.
+                wait (20);
+            }
+        }
     }
 
-    void deleteFreeQueue() noexcept
+    void writeBlocks (int numBlocks)
     {
-        auto b = firstFree;
-        firstFree = nullptr;
+        // Each writer's blocks in this batch are gathered in one pass, in order, so
+        // that they can go to disk in one write
+        batchIndexes.clear();
+        int numBatches = 0;
 
-        while (b != nullptr)
+        for (int i = 0; i < numBlocks; ++i)
         {
-            std::unique_ptr<QueuedBlock> toDelete (b);
-            b = b->next;
+            auto b = queue.getPendingBlock (i);
+
+            if (b->writer == nullptr)
+                continue;
+
+            auto found = batchIndexes.find (b->writer);
+            int index;
+
+            if (found != batchIndexes.end())
+            {
+                index = found->second;
+            }
+            else
+            {
+                index = numBatches++;
+                batchIndexes[b->writer] = index;
+
+                if ((int) batches.size() < numBatches)
+                    batches.emplace_back();
+
+                batches[(size_t) index].clear();
+            }
+
+            batches[(size_t) index].push_back (b);
         }
+
+        for (int i = 0; i < numBatches; ++i)
+            writeBatch (batches[(size_t) i]);
     }
+
+    void writeBatch (const std::vector<BlockQueue::QueuedBlock*>& blocks)
+    {
+        auto& writer = *blocks.front()->writer;
+        auto& state = getFileState (writer);
+
+        // Anything dropped before a block is made up with silence, so the rest of
+        // the file stays in time
+        juce::int64 totalSamples = 0, silenceBefore = state.silenceWritten;
+
+        for (auto b : blocks)
+        {
+            totalSamples += jmax ((juce::int64) 0, b->samplesDroppedBefore - silenceBefore) + b->buffer.getNumSamples();
+            silenceBefore = jmax (silenceBefore, b->samplesDroppedBefore);
+        }
+
+        batchBuffer.setSize (blocks.front()->buffer.getNumChannels(), (int) totalSamples, false, false, true);
+        juce::int64 silenceAdded = 0;
+        int offset = 0;
+
+        for (auto b : blocks)
+        {
+            auto gap = (int) (b->samplesDroppedBefore - state.silenceWritten);
+
+            if (gap > 0)
+            {
+                batchBuffer.clear (offset, gap);
+
+                if (b->thumbnail != nullptr)
+                    b->thumbnail->addBlock (batchBuffer, offset, gap);
+
+                state.addSilence (gap);
+                silenceAdded += gap;
+                offset += gap;
+            }
+
+            auto numSamples = b->buffer.getNumSamples();
+
+            for (int chan = batchBuffer.getNumChannels(); --chan >= 0;)
+                batchBuffer.copyFrom (chan, offset, b->buffer, jmin (chan, b->buffer.getNumChannels() - 1), 0, numSamples);
+
+            if (b->thumbnail != nullptr)
+                b->thumbnail->addBlock (b->buffer, 0, numSamples);
+
+            offset += numSamples;
+        }
+
+        const auto startTicks = Time::getHighResolutionTicks();
+        const bool ok = writer.appendBuffer (batchBuffer, (int) totalSamples);
+        const auto writeMs = Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - startTicks) * 1000.0;
+
+        state.addWrite ((int) totalSamples, writeMs, (int) blocks.size());
+
+        if (silenceAdded > 0)
+            TRACKTION_LOG_ERROR ("Audio recording dropped " + String (silenceAdded) + " samples of "
+                                   + writer.file.getFile().getFileName() + ", replaced with silence");
+
+        if (! ok && ! owner.hasSentStop.exchange (true))
+        {
+            TRACKTION_LOG_ERROR ("Audio recording failed to write to disk!");
+            owner.startTimer (1);
+        }
+    }
+
+    FileState& getFileState (AudioFileWriter& writer)
+    {
+        const ScopedLock sl (fileLock);
+        auto& state = files[&writer];
+
+        if (state == nullptr)
+            state = std::make_unique<FileState> (writer, threadIndex,
+                                                 owner.engine.getEngineBehaviour().shouldPreallocateRecordingFiles(),
+                                                 owner.engine.getEngineBehaviour().shouldBypassCacheForRecordings());
+
+        return *state;
+    }
+
+    /** Called once all of a writer's blocks have been written. */
+    void finishWriter (AudioFileWriter& writer)
+    {
+        // Anything dropped after the last block that was written still needs making up
+        auto dropped = queue.getSamplesDropped (writer);
+
+        if (dropped > 0)
+        {
+            auto& state = getFileState (writer);
+            auto numLeft = dropped - state.silenceWritten;
+
+            if (numLeft > 0)
+            {
+                juce::AudioBuffer<float> silence (jmax (1, writer.getNumChannels()), (int) jmin ((juce::int64) 8192, numLeft));
+                silence.clear();
+
+                for (auto num = numLeft; num > 0;)
+                {
+                    auto numThisTime = (int) jmin ((juce::int64) silence.getNumSamples(), num);
+                    writer.appendBuffer (silence, numThisTime);
+                    num -= numThisTime;
+                }
+
+                state.addSilence (numLeft);
+                TRACKTION_LOG_ERROR ("Audio recording dropped " + String (numLeft) + " samples at the end of "
+                                       + writer.file.getFile().getFileName() + ", replaced with silence");
+            }
+
+            queue.resetDroppedSamples (writer);
+        }
+
+        const ScopedLock sl (fileLock);
+        auto found = files.find (&writer);
+
+        if (found != files.end())
+        {
+            found->second->finish();
+            finishedFiles.add (found->second->getStats());
+            files.erase (found);
+        }
+    }
+
+    void addStats (juce::Array<WriterStats>& stats) const
+    {
+        const ScopedLock sl (fileLock);
+        stats.addArray (finishedFiles);
+
+        for (auto& f : files)
+            stats.add (f.second->getStats());
+    }
+
+    WaveInputRecordingThread& owner;
+    const int threadIndex;
+    BlockQueue queue;
+    juce::AudioBuffer<float> batchBuffer;
+    std::vector<std::vector<BlockQueue::QueuedBlock*>> batches;
+    std::unordered_map<AudioFileWriter*, int> batchIndexes;
+
+    CriticalSection fileLock;
+    std::map<AudioFileWriter*, std::unique_ptr<FileState>> files;
+    juce::Array<WriterStats> finishedFiles;
+
+    JUCE_DECLARE_NON_COPYABLE (WriterThread)
 };
 
 //==============================================================================
 WaveInputRecordingThread::WaveInputRecordingThread (Engine& e)
-    : Thread ("WaveInputRecordingThread"),
-      engine (e),
-      queue (new BlockQueue())
+    : engine (e)
 {
 }
 
 WaveInputRecordingThread::~WaveInputRecordingThread()
 {
     flushAndStop();
-    queue->deleteFreeQueue();
-    queue.reset();
+    writerThreads.clear();
 }
 
 void WaveInputRecordingThread::addUser()
@@ -1863,65 +2430,81 @@ void WaveInputRecordingThread::removeUser()
         flushAndStop();
 }
 
-//==============================================================================
-void WaveInputRecordingThread::addBlockToRecord (AudioFileWriter& writer, const juce::AudioBuffer<float>& buffer,
-                                                 int start, int numSamples, const RecordingThumbnailManager::Thumbnail::Ptr& thumbnail)
+juce::int64 WaveInputRecordingThread::getNumBlocksDropped() const noexcept
 {
-    if (! threadShouldExit())
-    {
-        auto block = queue->findFreeBlock();
-        block->load (writer, buffer, start, numSamples, thumbnail);
-        queue->addToPendingQueue (block);
-        notify();
-    }
+    juce::int64 total = 0;
+
+    for (auto t : writerThreads)
+        total += t->queue.numDropped.load (std::memory_order_relaxed);
+
+    return total;
 }
 
-void WaveInputRecordingThread::waitForWriterToFinish (AudioFileWriter& writer)
+juce::Array<WaveInputRecordingThread::WriterStats> WaveInputRecordingThread::getWriterStats() const
 {
-    while (queue->isWriterInQueue (writer) && isThreadRunning())
-        Thread::sleep (2);
+    juce::Array<WriterStats> stats;
+
+    for (auto t : writerThreads)
+        t->addStats (stats);
+
+    return stats;
 }
 
-void WaveInputRecordingThread::run()
+WaveInputRecordingThread::WriterThread* WaveInputRecordingThread::getThreadFor (AudioFileWriter& writer) const noexcept
 {
-    CRASH_TRACER
-    FloatVectorOperations::disableDenormalisedNumberSupport();
+    if (writerThreads.size() <= 1)
+        return writerThreads.getFirst();
+
+    // Writers are allocated next to each other, so the address is mixed up to spread them evenly
+    auto h = (juce::uint64) (juce::pointer_sized_uint) &writer;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
 
-    for (;;)
+    return writerThreads.getUnchecked ((int) (h % (juce::uint64) writerThreads.size()));
+}
+
+//==============================================================================
+void WaveInputRecordingThread::addBlockToRecord (AudioFileWriter& writer, const juce::AudioBuffer<float>& buffer,
+                                                 int start, int numSamples, const RecordingThumbnailManager::Thumbnail::Ptr& thumbnail)
+{
+    auto thread = getThreadFor (writer);
+
+    if (thread == nullptr || thread->threadShouldExit())
+        return;
+
+    auto& queue = thread->queue;
+    auto samplesDropped = queue.getSamplesDropped (writer);
+
+    // Blocks bigger than the slots are split up rather than reallocating anything
+    while (numSamples > 0)
     {
-        if (queue->numPending > 500 && ! hasWarned)
+        auto num = jmin (numSamples, queue.maxNumSamples);
+
+        if (! queue.push (writer, buffer, start, num, samplesDropped, thumbnail))
         {
-            hasWarned = true;
-            TRACKTION_LOG_ERROR ("Audio recording can't keep up!");
+            queue.addDroppedSamples (writer, num);
+            samplesDropped += num;
         }
 
-        if (auto block = queue->removeFirstPending())
-        {
-            if (! block->writer.load()->appendBuffer (block->buffer, block->buffer.getNumSamples()))
-            {
-                if (! hasSentStop)
-                {
-                    hasSentStop = true;
-                    TRACKTION_LOG_ERROR ("Audio recording failed to write to disk!");
-                    startTimer (1);
-                }
-            }
+        start += num;
+        numSamples -= num;
+    }
+}
 
-            if (block->thumbnail != nullptr)
-            {
-                block->thumbnail->addBlock (block->buffer, 0, block->buffer.getNumSamples());
-                block->thumbnail = nullptr;
-            }
+void WaveInputRecordingThread::waitForWriterToFinish (AudioFileWriter& writer)
+{
+    if (auto thread = getThreadFor (writer))
+    {
+        // All this writer's blocks have been queued by now, so once everything queued
+        // so far has been written, so have they
+        auto& queue = thread->queue;
+        auto target = queue.numQueued.load (std::memory_order_relaxed);
 
-            queue->addToFreeQueue (block);
-        }
-        else
-        {
-            if (threadShouldExit())
-                break;
+        while (queue.numFinished.load (std::memory_order_acquire) < target && thread->isThreadRunning())
+            Thread::sleep (2);
 
-            wait (401);
-        }
+        thread->finishWriter (writer);
     }
 }
 
@@ -1934,17 +2517,61 @@ void WaveInputRecordingThread::timerCallback()
 void WaveInputRecordingThread::prepareToStart()
 {
     flushAndStop();
-    sleep (2);
-    jassert (! isThreadRunning());
-    startThread (5);
+
+    // Nothing's recording, so the threads and queues can be set up for the inputs that might be
+    auto& dm = engine.getDeviceManager();
+    int numInputs = 0, numChannels = 2;
+
+    for (int i = dm.getNumWaveInDevices(); --i >= 0;)
+    {
+        if (auto wi = dm.getWaveInDevice (i))
+        {
+            if (wi->isEnabled())
+            {
+                ++numInputs;
+                numChannels = jmax (numChannels, (int) wi->getChannels().size());
+            }
+        }
+    }
+
+    auto numThreads = jlimit (1, jmax (1, numInputs), engine.getEngineBehaviour().getNumberOfRecordingThreads());
+    auto blockSize = jmax (64, dm.getBlockSize());
+    auto bufferedSeconds = jmax (0.1, engine.getEngineBehaviour().getRecordingBufferSeconds());
+    auto blocksPerInput = roundToInt (std::ceil (bufferedSeconds * dm.getSampleRate() / blockSize));
+
+    // Files aren't shared out perfectly evenly, so each queue has room for a few more than its share
+    auto inputsPerThread = jmin (numInputs, 2 * ((numInputs + numThreads - 1) / numThreads));
+    auto numBlocks = jmax (minNumBlocks, inputsPerThread * blocksPerInput);
+
+    bool needsNewThreads = writerThreads.size() != numThreads;
+
+    for (auto t : writerThreads)
+        if (numBlocks > (int) t->queue.blocks.size() || numChannels > t->queue.maxNumChannels || blockSize > t->queue.maxNumSamples)
+            needsNewThreads = true;
+
+    if (needsNewThreads)
+    {
+        writerThreads.clear();
+
+        for (int i = 0; i < numThreads; ++i)
+            writerThreads.add (new WriterThread (*this, i, numBlocks, numChannels, blockSize));
+    }
+
+    for (auto t : writerThreads)
+    {
+        const ScopedLock sl (t->fileLock);
+        t->files.clear();
+        t->finishedFiles.clear();
+        t->queue.clearDroppedSamples();
+        t->startThread (5);
+    }
 }
 
 void WaveInputRecordingThread::flushAndStop()
 {
-    signalThreadShouldExit();
-    notify();
-    stopThread (30000);
-    queue->moveAnyPendingBlocksToFree();
+    for (auto t : writerThreads)
+        t->flushAndStop();
+
     hasSentStop = false;
     hasWarned = false;
 }
@@ -112,8 +112,13 @@ private:
 
 
 //==============================================================================
-class WaveInputRecordingThread  : public juce::Thread,
-                                  private juce::Timer
+/**
+    Writes the audio being recorded from wave inputs to disk.
+
+    The files are shared out between a pool of threads, each with its own queue,
+    which the audio thread can add blocks to without allocating or waiting.
+*/
+class WaveInputRecordingThread  : private juce::Timer
 {
 public:
     //==============================================================================
@@ -136,18 +141,46 @@ public:
     void addBlockToRecord (AudioFileWriter&, const juce::AudioBuffer<float>&,
                            int start, int numSamples, const RecordingThumbnailManager::Thumbnail::Ptr&);
     void waitForWriterToFinish (AudioFileWriter&);
-    void run() override;
     void timerCallback() override;
 
+    /** Returns the number of blocks lost since recording started because the
+        disk couldn't keep up. Silence is written in their place, so the takes
+        stay in time.
+    */
+    juce::int64 getNumBlocksDropped() const noexcept;
+
+    //==============================================================================
+    /** A snapshot of how a file being recorded is being written. */
+    struct WriterStats
+    {
+        juce::File file;
+        int threadIndex = 0;                /**< The thread in the pool that writes this file. */
+        juce::int64 numWrites = 0;
+        juce::int64 numSamplesWritten = 0;
+        double averageWriteMs = 0.0;
+        double maxWriteMs = 0.0;
+        int queueDepth = 0;                 /**< The number of blocks that were waiting when the file was last written. */
+        juce::int64 numSamplesDropped = 0;  /**< The number of samples of silence written in place of dropped audio. */
+        bool finished = false;              /**< True once all the file's audio has been written. */
+    };
+
+    /** Returns the stats for the files written since recording last started. */
+    juce::Array<WriterStats> getWriterStats() const;
+
     Engine& engine;
 
 private:
-    int activeUsers = 0;
-    bool hasWarned = false, hasSentStop = false;
+    static constexpr int minNumBlocks = 64, maxBlocksPerBatch = 1024;
 
     struct BlockQueue;
-    std::unique_ptr<BlockQueue> queue;
+    struct FileState;
+    struct WriterThread;
+
+    int activeUsers = 0;
+    std::atomic<bool> hasWarned { false }, hasSentStop { false };
+    juce::OwnedArray<WriterThread> writerThreads;
 
+    WriterThread* getThreadFor (AudioFileWriter&) const noexcept;
     void prepareToStart();
     void flushAndStop();
 
@@ -454,7 +454,8 @@ private:
 //==============================================================================
 /**
     Simple processor for a Node which uses an InputProvider to pass input in to the graph.
-    This simply iterate all the nodes attempting to process them in a single thread.
+    The NodePlayerType decides how the nodes are processed, e.g. a NodePlayer iterates them
+    in a single thread and a MultiThreadedNodePlayer shares them out between several.
 */
 template<typename NodePlayerType>
 class RackNodePlayer
@@ -483,6 +484,12 @@ public:
         return nodePlayer.getNode().getNodeProperties().latencyNumSamples;
     }
 
+    /** Returns the player, e.g. to configure its threads before calling prepareToPlay. */
+    NodePlayerType& getNodePlayer()
+    {
+        return nodePlayer;
+    }
+
     /** Processes a block of audio and MIDI data.
         Returns the number of times a node was checked but unable to be processed.
     */
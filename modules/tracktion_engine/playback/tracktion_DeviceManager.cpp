@@ -1054,6 +1054,14 @@ double DeviceManager::getOutputLatencySeconds() const
     return outputLatencyTime;
 }
 
+juce::int64 DeviceManager::getCurrentCallbackDeadline() const noexcept
+{
+    if (Thread::getCurrentThreadId() != callbackThreadID.load (std::memory_order_relaxed))
+        return 0;
+
+    return callbackDeadlineTicks;
+}
+
 void DeviceManager::audioDeviceIOCallback (const float** inputChannelData, int numInputChannels,
                                            float** outputChannelData, int totalNumOutputChannels,
                                            int numSamples)
@@ -1061,12 +1069,19 @@ void DeviceManager::audioDeviceIOCallback (const float** inputChannelData, int n
     CRASH_TRACER
     FloatVectorOperations::disableDenormalisedNumberSupport();
 
+    if (callbackThreadNeedsConfiguring.exchange (false))
+        AudioWorkerThreads::configureCurrentThreadAsDeviceCallback (callbackThreadOptions);
+
     {
        #if JUCE_ANDROID
         const ScopedSteadyLoad load (steadyLoadContext, numSamples);
        #endif
 
         const auto startTimeTicks = Time::getHighResolutionTicks();
+        callbackThreadID.store (Thread::getCurrentThreadId(), std::memory_order_relaxed);
+
+        if (currentSampleRate > 0)
+            callbackDeadlineTicks = startTimeTicks + Time::secondsToHighResolutionTicks (numSamples / currentSampleRate);
 
         if (currentCpuUsage > cpuLimitBeforeMuting)
         {
@@ -1124,6 +1139,8 @@ void DeviceManager::audioDeviceIOCallback (const float** inputChannelData, int n
             globalOutputAudioProcessor->processBlock (ab, mb);
         }
 
+        callbackDeadlineTicks = 0;
+
         {
             const auto timeWindowSec = numSamples / static_cast<float> (currentSampleRate);
 
@@ -1168,6 +1185,10 @@ void DeviceManager::audioDeviceAboutToStart (AudioIODevice* device)
     if (waveDeviceListNeedsRebuilding())
         rebuildWaveDeviceList();
 
+    callbackThreadOptions = engine.getEngineBehaviour().getAudioWorkerThreadOptions();
+    callbackThreadNeedsConfiguring = callbackThreadOptions.deviceCallbackCPU >= 0
+                                      || callbackThreadOptions.realtimePriority > 0;
+
     reloadAllContextDevices();
 
     const ScopedLock sl (contextLock);
@@ -153,6 +153,13 @@ public:
 
     double getOutputLatencySeconds() const;
 
+    /** Returns the time, in high resolution ticks, by which the audio callback that's
+        currently running needs to have finished, or 0 if there isn't one running.
+        This returns 0 on any thread other than the device's callback thread, as other
+        threads (e.g. one that's rendering) aren't held to the callback's deadline.
+    */
+    juce::int64 getCurrentCallbackDeadline() const noexcept;
+
     std::unique_ptr<HostedAudioDeviceInterface> hostedAudioDeviceInterface;
     juce::AudioDeviceManager deviceManager;
 
@@ -191,6 +198,8 @@ private:
     bool sendMidiTimecode = false;
 
     std::atomic<double> currentCpuUsage { 0 }, streamTime { 0 };
+    std::atomic<juce::Thread::ThreadID> callbackThreadID { nullptr };
+    juce::int64 callbackDeadlineTicks = 0; // only used on the callback thread
     double cpuLimitBeforeMuting = 0.95;
     double currentLatencyMs = 0, outputLatencyTime = 0, currentSampleRate = 0;
     double speedCompensation = 0;
@@ -216,6 +225,9 @@ private:
 
     juce::ListenerList<CPUUsageListener> cpuUsageListeners;
 
+    AudioWorkerThreadOptions callbackThreadOptions;
+    std::atomic<bool> callbackThreadNeedsConfiguring { false };
+
     void initialiseMidi();
     void rebuildWaveDeviceList();
     bool waveDeviceListNeedsRebuilding();
@@ -12,47 +12,101 @@ namespace tracktion_engine
 {
 
 MidiNoteDispatcher::MidiNoteDispatcher()
+    : juce::Thread ("MIDI Output")
 {
+    resetJitterStats();
 }
 
 MidiNoteDispatcher::~MidiNoteDispatcher()
 {
-    stopTimer();
+    stopThread (1000);
 }
 
 void MidiNoteDispatcher::nextBlockStarted (PlayHead& playhead, EditTimeRange streamTime, int blockSize)
 {
-    ScopedLock s (deviceLock);
+    // This is only ever contended while setMidiDeviceList() swaps the list over
+    const SpinLock::ScopedLockType sl (deviceLock);
+    bool anythingQueued = false;
 
     for (auto state : devices)
     {
         auto delay = state->device->getMidiOutput().getDeviceDelay();
         auto& buffer = state->device->refillBuffer (playhead, streamTime - delay, blockSize);
         state->device->context.masterLevels.processMidi (buffer, nullptr);
-        
+
         if (! state->device->sendMessages (playhead, buffer, streamTime - delay))
-            state->buffer.mergeFromAndClear (buffer);
+        {
+            if (buffer.isAllNotesOff)
+            {
+                state->allNotesOffPending = true;
+                anythingQueued = true;
+            }
+            else
+            {
+                for (auto& m : buffer)
+                {
+                    if (state->messages.push (static_cast<const MidiMessage&> (m)))
+                        anythingQueued = true;
+                    else
+                        numDropped.fetch_add (1, std::memory_order_relaxed);
+                }
+            }
+
+            buffer.clear();
+        }
     }
+
+    // Signalling the sender thread's event could block on its mutex, so this just
+    // sets a flag that the thread polls
+    if (anythingQueued)
+        messagesQueued.store (true, std::memory_order_release);
 }
 
 void MidiNoteDispatcher::masterTimeUpdate (PlayHead& playhead, double streamTime)
 {
-    const ScopedLock s (timeLock);
-    masterTime = playhead.streamTimeToSourceTime (streamTime);
-    hiResClockOfMasterTime = Time::getMillisecondCounterHiRes();
+    setMasterTime (playhead.streamTimeToSourceTime (streamTime));
 }
 
 void MidiNoteDispatcher::prepareToPlay (PlayHead& playhead, double start)
 {
-    const ScopedLock s (timeLock);
-    masterTime = playhead.streamTimeToSourceTime (start);
-    hiResClockOfMasterTime = Time::getMillisecondCounterHiRes();
+    setMasterTime (playhead.streamTimeToSourceTime (start));
+}
+
+void MidiNoteDispatcher::setMasterTime (double time)
+{
+    auto version = timeVersion.load (std::memory_order_relaxed);
+
+    // Writers take turns by making the version odd
+    for (;;)
+    {
+        if ((version & 1) == 0
+             && timeVersion.compare_exchange_weak (version, version + 1, std::memory_order_acquire))
+            break;
+
+        version = timeVersion.load (std::memory_order_relaxed);
+    }
+
+    masterTime.store (time, std::memory_order_relaxed);
+    hiResClockOfMasterTime.store (Time::getMillisecondCounterHiRes(), std::memory_order_relaxed);
+    timeVersion.store (version + 2, std::memory_order_release);
 }
 
 double MidiNoteDispatcher::getCurrentTime() const
 {
-    const ScopedLock s (timeLock);
-    return masterTime + (Time::getMillisecondCounterHiRes() - hiResClockOfMasterTime) * 0.001;
+    for (;;)
+    {
+        auto version = timeVersion.load (std::memory_order_acquire);
+
+        if ((version & 1) != 0)
+            continue;
+
+        auto time = masterTime.load (std::memory_order_relaxed);
+        auto clock = hiResClockOfMasterTime.load (std::memory_order_relaxed);
+        std::atomic_thread_fence (std::memory_order_acquire);
+
+        if (timeVersion.load (std::memory_order_relaxed) == version)
+            return time + (Time::getMillisecondCounterHiRes() - clock) * 0.001;
+    }
 }
 
 void MidiNoteDispatcher::setMidiDeviceList (const OwnedArray<MidiOutputDeviceInstance>& newList)
@@ -63,75 +117,125 @@ void MidiNoteDispatcher::setMidiDeviceList (const OwnedArray<MidiOutputDeviceIns
     for (auto* d : newList)
         newDevices.add (new DeviceState (d));
 
-    if (newList.isEmpty())
-        stopTimer();
-
-    bool startTimerFlag = false;
+    // The sender thread reads the list without locking, so it has to be stopped while it changes
+    stopThread (1000);
 
     {
-        const ScopedLock sl (deviceLock);
+        const SpinLock::ScopedLockType sl (deviceLock);
         newDevices.swapWith (devices);
-        startTimerFlag = ! devices.isEmpty();
     }
 
-    if (startTimerFlag)
-        startTimer (1);
+    if (! newList.isEmpty())
+        startThread (Thread::realtimeAudioPriority);
 }
 
-void MidiNoteDispatcher::hiResTimerCallback()
+//==============================================================================
+void MidiNoteDispatcher::run()
 {
-    struct MessageToSend
+    while (! threadShouldExit())
     {
-        MidiOutputDeviceInstance* device;
-        MidiMessage message;
-    };
+        messagesQueued.store (false, std::memory_order_relaxed);
+        auto nextTime = sendDueMessages();
 
-    Array<MessageToSend> messagesToSend;
-    messagesToSend.ensureStorageAllocated (32);
+        // With nothing queued this checks back every millisecond, unless the audio
+        // thread has pushed something since the queues were last looked at
+        if (nextTime < 0)
+        {
+            if (! messagesQueued.load (std::memory_order_acquire))
+                wait (idlePollIntervalMs);
+
+            continue;
+        }
 
+        auto msUntilNext = (nextTime - getCurrentTime()) * 1000.0;
+
+        // Sleeping tends to overshoot, so once the next message is close this just
+        // yields until it's due. The sleeps are kept short so that messages pushed by
+        // the audio thread in the meantime are noticed promptly.
+        if (msUntilNext > 1.5)
+            wait (1);
+        else if (msUntilNext > 0.0)
+            Thread::yield();
+    }
+}
+
+double MidiNoteDispatcher::sendDueMessages()
+{
+    double nextTime = -1.0;
+
+    for (auto d : devices)
     {
-        const ScopedLock sl (deviceLock);
+        auto& midiOut = d->device->getMidiOutput();
 
-        for (auto d : devices)
+        if (d->allNotesOffPending.exchange (false))
         {
-            auto* device = d->device;
-            auto& buffer = d->buffer;
-            auto& midiOut = device->getMidiOutput();
+            d->messages.clear();
+            midiOut.sendNoteOffMessages();
+            continue;
+        }
 
-            if (buffer.isAllNotesOff)
+        while (auto message = d->messages.peek())
+        {
+            auto noteTime = message->getTimeStamp();
+            auto currentTime = getCurrentTime();
+
+            if (noteTime > currentTime + 0.2)
+            {
+                d->messages.skip();
+                numDropped.fetch_add (1, std::memory_order_relaxed);
+            }
+            else if (noteTime <= currentTime)
             {
-                buffer.clear();
-                midiOut.sendNoteOffMessages();
+                midiOut.fireMessage (*message);
+                addLateness ((getCurrentTime() - noteTime) * 1000.0);
+                d->messages.skip();
             }
             else
             {
-                while (buffer.isNotEmpty())
-                {
-                    auto& message = buffer[0];
-
-                    auto noteTime = message.getTimeStamp();
-                    auto currentTime = getCurrentTime();
-
-                    if (noteTime > currentTime + 0.2)
-                    {
-                        buffer.remove (0);
-                    }
-                    else if (noteTime <= currentTime)
-                    {
-                        messagesToSend.add ({ device, message });
-                        buffer.remove (0);
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
+                nextTime = nextTime < 0 ? noteTime : jmin (nextTime, noteTime);
+                break;
             }
         }
     }
 
-    for (auto& m : messagesToSend)
-        m.device->getMidiOutput().fireMessage (m.message);
+    return nextTime;
+}
+
+//==============================================================================
+void MidiNoteDispatcher::addLateness (double latenessMs) noexcept
+{
+    auto bin = jlimit (0, JitterStats::numBins - 1, (int) (latenessMs / JitterStats::binWidthMs));
+    latenessCounts[(size_t) bin].fetch_add (1, std::memory_order_relaxed);
+    numSent.fetch_add (1, std::memory_order_relaxed);
+
+    auto lastMax = maxLatenessMs.load (std::memory_order_relaxed);
+
+    while (latenessMs > lastMax && ! maxLatenessMs.compare_exchange_weak (lastMax, latenessMs, std::memory_order_relaxed))
+    {}
+}
+
+MidiNoteDispatcher::JitterStats MidiNoteDispatcher::getJitterStats() const
+{
+    JitterStats stats;
+
+    for (size_t i = 0; i < latenessCounts.size(); ++i)
+        stats.counts[i] = latenessCounts[i].load (std::memory_order_relaxed);
+
+    stats.maxLatenessMs = maxLatenessMs.load (std::memory_order_relaxed);
+    stats.numSent = numSent.load (std::memory_order_relaxed);
+    stats.numDropped = numDropped.load (std::memory_order_relaxed);
+
+    return stats;
+}
+
+void MidiNoteDispatcher::resetJitterStats()
+{
+    for (auto& c : latenessCounts)
+        c.store (0, std::memory_order_relaxed);
+
+    maxLatenessMs.store (0.0, std::memory_order_relaxed);
+    numSent.store (0, std::memory_order_relaxed);
+    numDropped.store (0, std::memory_order_relaxed);
 }
 
 }
@@ -11,7 +11,16 @@
 namespace tracktion_engine
 {
 
-class MidiNoteDispatcher   : private juce::HighResolutionTimer
+/**
+    Sends the MIDI rendered for each output device at the right time.
+
+    The audio thread pushes each block's messages into a queue per device, and a
+    sender thread takes them off and fires them as their timestamps come due.
+    Neither side waits for the other. While nothing is queued the sender thread
+    sleeps for a millisecond at a time and checks a flag the audio thread sets when
+    it pushes some messages, so the audio thread never has to signal it.
+*/
+class MidiNoteDispatcher   : private juce::Thread
 {
 public:
     MidiNoteDispatcher();
@@ -24,7 +33,28 @@ public:
     void masterTimeUpdate (PlayHead& playhead, double streamTime);
     void prepareToPlay (PlayHead& playhead, double start);
 
-    void hiResTimerCallback() override;
+    //==============================================================================
+    /** A record of how late messages were sent compared to their timestamps. */
+    struct JitterStats
+    {
+        static constexpr int numBins = 40;
+        static constexpr double binWidthMs = 0.25;
+
+        /** The number of messages sent in each 0.25ms band of lateness.
+            The last bin also counts anything later than that.
+        */
+        std::array<juce::int64, numBins> counts {};
+
+        double maxLatenessMs = 0.0;     /**< The latest a message has been sent. */
+        juce::int64 numSent = 0;        /**< The total number of messages sent. */
+        juce::int64 numDropped = 0;     /**< Messages lost to a full queue or too far ahead to send. */
+    };
+
+    /** Returns the lateness of the messages sent since the last reset. */
+    JitterStats getJitterStats() const;
+
+    /** Clears the jitter measurements. */
+    void resetJitterStats();
 
 private:
     //==============================================================================
@@ -33,14 +63,30 @@ private:
         DeviceState (MidiOutputDeviceInstance* d) : device (d) {}
 
         MidiOutputDeviceInstance* device;
-        MidiMessageArray buffer;
+        LockFreeFifo<juce::MidiMessage> messages { 4096 };
+        std::atomic<bool> allNotesOffPending { false };
     };
 
     //==============================================================================
     juce::OwnedArray<DeviceState> devices;
-    juce::CriticalSection timeLock, deviceLock;
-    double masterTime = 0, hiResClockOfMasterTime = 0;
+    juce::SpinLock deviceLock;
+
+    // A sequence lock: the version is odd while the time is being written
+    std::atomic<juce::uint32> timeVersion { 0 };
+    std::atomic<double> masterTime { 0.0 }, hiResClockOfMasterTime { 0.0 };
+
+    std::array<std::atomic<juce::int64>, JitterStats::numBins> latenessCounts;
+    std::atomic<double> maxLatenessMs { 0.0 };
+    std::atomic<juce::int64> numSent { 0 }, numDropped { 0 };
+
+    static constexpr int idlePollIntervalMs = 1;
+    std::atomic<bool> messagesQueued { false };
+
+    void run() override;
+    double sendDueMessages();
+    void addLateness (double latenessMs) noexcept;
 
+    void setMasterTime (double);
     double getCurrentTime() const;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MidiNoteDispatcher)
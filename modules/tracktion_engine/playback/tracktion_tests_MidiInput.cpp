@@ -0,0 +1,315 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+#if TRACKTION_UNIT_TESTS
+
+class MidiInputStressTests    : public juce::UnitTest
+{
+public:
+    MidiInputStressTests()
+        : juce::UnitTest ("MidiInputStressTests", "Tracktion:Longer") {}
+
+    //==============================================================================
+    void runTest() override
+    {
+        auto& engine = *Engine::getEngines()[0];
+        engine.getPluginManager().createBuiltInType<MidiCounterPlugin>();
+
+        HostedAudioDeviceInterface::Parameters params;
+        params.sampleRate = 44100.0;
+        params.blockSize = 256;
+        params.inputChannels = 0;
+        params.fixedBlockSize = true;
+
+        auto& deviceManager = engine.getDeviceManager();
+        auto& audioIO = deviceManager.getHostedAudioDeviceInterface();
+        audioIO.initialise (params);
+        audioIO.prepareToPlay (params.sampleRate, params.blockSize);
+
+        runLivePlayTest (engine, params);
+        runControllerParserTest (engine);
+
+        deviceManager.closeDevices();
+        deviceManager.removeHostedAudioDeviceInterface();
+        deviceManager.deviceManager.closeAudioDevice();
+    }
+
+    void runLivePlayTest (Engine& engine, const HostedAudioDeviceInterface::Parameters& params)
+    {
+        beginTest ("10k messages a second across 16 inputs");
+
+        constexpr int numInputs = 16, totalMessagesPerSecond = 10000;
+        constexpr double testLengthSeconds = 3.0;
+
+        auto& deviceManager = engine.getDeviceManager();
+        auto& audioIO = deviceManager.getHostedAudioDeviceInterface();
+        auto devices = createVirtualDevices (deviceManager, numInputs);
+        expectEquals (devices.size(), numInputs);
+
+        auto edit = std::make_unique<Edit> (Edit::Options { engine, createEmptyEdit (engine), ProjectItemID::createNewID (0) });
+        edit->ensureNumberOfAudioTracks (numInputs);
+        auto& transport = edit->getTransport();
+        transport.ensureContextAllocated();
+
+        Array<MidiCounterPlugin*> counters;
+
+        for (auto t : getAudioTracks (*edit))
+        {
+            auto plugin = edit->getPluginCache().createNewPlugin (MidiCounterPlugin::xmlTypeName, {});
+            t->pluginList.insertPlugin (plugin, 0, nullptr);
+            counters.add (dynamic_cast<MidiCounterPlugin*> (plugin.get()));
+        }
+
+        // Each input plays live into its own track, whose plugin checks what arrives
+        for (auto in : transport.getCurrentPlaybackContext()->getAllInputs())
+        {
+            auto index = devices.indexOf (dynamic_cast<VirtualMidiInputDevice*> (&in->owner));
+
+            if (index >= 0)
+                in->setTargetTrack (*getAudioTracks (*edit)[index], 0, true);
+        }
+
+        transport.ensureContextAllocated (true);
+        transport.play (false);
+
+        {
+            ProcessThread processThread (audioIO, params);
+
+            OwnedArray<Sender> senders;
+
+            for (auto d : devices)
+                senders.add (new Sender (*d, totalMessagesPerSecond / (double) numInputs));
+
+            for (auto s : senders)
+                s->startThread (8);
+
+            Thread::sleep (roundToInt (testLengthSeconds * 1000.0));
+
+            for (auto s : senders)
+                s->stopThread (1000);
+
+            // Give the last messages time to reach the plugins
+            Thread::sleep (100);
+
+            int numSent = 0, numReceived = 0, numDropped = 0;
+            bool allInOrder = true;
+
+            for (int i = 0; i < numInputs; ++i)
+            {
+                numSent += senders[i]->numSent;
+                numReceived += counters[i]->numReceived.load();
+                numDropped += devices[i]->getNumMessagesDropped();
+                allInOrder = allInOrder && counters[i]->allInOrder.load();
+            }
+
+            logMessage ("Messages sent: " + String (numSent) + ", received: " + String (numReceived)
+                         + ", dropped: " + String (numDropped));
+            logMessage ("Time to process a block: average " + String (processThread.getAverageBlockMs(), 4)
+                         + "ms, max " + String (processThread.getMaxBlockMs(), 4) + "ms, block length "
+                         + String (1000.0 * params.blockSize / params.sampleRate, 4) + "ms");
+
+            expect (numSent >= totalMessagesPerSecond * testLengthSeconds * 0.9, "Too few messages were sent");
+            expectEquals (numDropped, 0);
+            expectEquals (numReceived, numSent);
+            expect (allInOrder, "Messages were received out of order");
+        }
+
+        transport.stop (false, true);
+        edit.reset();
+
+        for (auto d : devices)
+            deviceManager.deleteVirtualMidiDevice (d);
+    }
+
+    void runControllerParserTest (Engine& engine)
+    {
+        beginTest ("Controller messages that can't be queued are counted");
+
+        auto& deviceManager = engine.getDeviceManager();
+        auto devices = createVirtualDevices (deviceManager, 1);
+        expectEquals (devices.size(), 1);
+
+        if (auto device = devices.getFirst())
+        {
+            {
+                // Nothing takes the messages off the queue until the message loop runs
+                MidiControllerParser parser (engine, *device);
+
+                for (int i = 0; i < 2000; ++i)
+                    parser.processMessage (MidiMessage::controllerEvent (1, 74, i & 0x7f));
+            }
+
+            expectEquals (device->getNumMessagesDropped(), 2000 - 1024);
+            deviceManager.deleteVirtualMidiDevice (device);
+        }
+    }
+
+private:
+    //==============================================================================
+    /** Counts the controller messages that reach it and checks they're in the order they were sent. */
+    struct MidiCounterPlugin  : public Plugin
+    {
+        MidiCounterPlugin (PluginCreationInfo info) : Plugin (info) {}
+        ~MidiCounterPlugin() override { notifyListenersOfDeletion(); }
+
+        static const char* getPluginName()                  { return "MIDI Counter"; }
+        static const char* xmlTypeName;
+
+        juce::String getName() override                     { return getPluginName(); }
+        juce::String getPluginType() override               { return xmlTypeName; }
+        juce::String getSelectableDescription() override    { return getName(); }
+        bool takesMidiInput() override                      { return true; }
+
+        void initialise (const PlaybackInitialisationInfo&) override {}
+        void deinitialise() override {}
+
+        void applyToBuffer (const AudioRenderContext& rc) override
+        {
+            if (rc.bufferForMidiMessages == nullptr)
+                return;
+
+            for (auto& m : *rc.bufferForMidiMessages)
+            {
+                if (m.isController() && m.getControllerNumber() == 74)
+                {
+                    if (m.getControllerValue() != (numReceived.load() & 0x7f))
+                        allInOrder = false;
+
+                    ++numReceived;
+                }
+            }
+        }
+
+        std::atomic<int> numReceived { 0 };
+        std::atomic<bool> allInOrder { true };
+    };
+
+    //==============================================================================
+    /** Sends controller messages to a device at a steady rate, like a busy MPE controller. */
+    struct Sender  : public Thread
+    {
+        Sender (VirtualMidiInputDevice& d, double rate)
+            : Thread ("MIDI Input Stress"), device (d), messagesPerSecond (rate)
+        {
+        }
+
+        void run() override
+        {
+            const auto startTime = Time::getMillisecondCounterHiRes();
+
+            while (! threadShouldExit())
+            {
+                auto elapsedSeconds = (Time::getMillisecondCounterHiRes() - startTime) * 0.001;
+
+                while (numSent < (int) (elapsedSeconds * messagesPerSecond))
+                {
+                    device.handleIncomingMidiMessage (MidiMessage::controllerEvent (1, 74, numSent & 0x7f));
+                    ++numSent;
+                }
+
+                Thread::sleep (1);
+            }
+        }
+
+        VirtualMidiInputDevice& device;
+        const double messagesPerSecond;
+        int numSent = 0;
+    };
+
+    //==============================================================================
+    /** Stands in for the audio device, calling the engine once per block. */
+    struct ProcessThread
+    {
+        ProcessThread (HostedAudioDeviceInterface& deviceInterface, const HostedAudioDeviceInterface::Parameters& params)
+            : audioIO (deviceInterface)
+        {
+            buffer.setSize (jmax (params.inputChannels, params.outputChannels), params.blockSize);
+            const auto msPerBlock = roundToInt ((params.blockSize / params.sampleRate) * 1000.0);
+
+            processThread = std::thread ([this, msPerBlock]
+                                         {
+                                             while (! shouldStop.load())
+                                             {
+                                                 auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds (msPerBlock);
+                                                 const auto startTicks = Time::getHighResolutionTicks();
+
+                                                 buffer.clear();
+                                                 midi.clear();
+                                                 audioIO.processBlock (buffer, midi);
+
+                                                 auto blockMs = Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - startTicks) * 1000.0;
+                                                 maxBlockMs = jmax (maxBlockMs.load(), blockMs);
+                                                 totalBlockMs = totalBlockMs + blockMs;
+                                                 ++numBlocks;
+
+                                                 std::this_thread::sleep_until (endTime);
+                                             }
+                                         });
+        }
+
+        ~ProcessThread()
+        {
+            shouldStop.store (true);
+            processThread.join();
+        }
+
+        double getAverageBlockMs() const    { return totalBlockMs.load() / jmax (1, numBlocks.load()); }
+        double getMaxBlockMs() const        { return maxBlockMs.load(); }
+
+    private:
+        HostedAudioDeviceInterface& audioIO;
+        AudioBuffer<float> buffer;
+        MidiBuffer midi;
+
+        std::thread processThread;
+        std::atomic<bool> shouldStop { false };
+        std::atomic<double> maxBlockMs { 0.0 }, totalBlockMs { 0.0 };
+        std::atomic<int> numBlocks { 0 };
+    };
+
+    //==============================================================================
+    static Array<VirtualMidiInputDevice*> createVirtualDevices (DeviceManager& deviceManager, int num)
+    {
+        Array<VirtualMidiInputDevice*> devices;
+
+        for (int i = 0; i < num; ++i)
+        {
+            auto name = "MIDI Input Stress " + String (i + 1);
+
+            if (deviceManager.createVirtualMidiDevice (name).failed())
+                continue;
+
+            for (int j = 0; j < deviceManager.getNumMidiInDevices(); ++j)
+            {
+                if (auto d = dynamic_cast<VirtualMidiInputDevice*> (deviceManager.getMidiInDevice (j)))
+                {
+                    if (d->getName() == name)
+                    {
+                        d->setEndToEndEnabled (true);
+                        devices.add (d);
+                    }
+                }
+            }
+        }
+
+        return devices;
+    }
+};
+
+const char* MidiInputStressTests::MidiCounterPlugin::xmlTypeName = "midiCounterTest";
+
+static MidiInputStressTests midiInputStressTests;
+
+#endif // TRACKTION_UNIT_TESTS
+
+}
@@ -127,6 +127,95 @@ public:
     juce::NormalisableRange<float> conversionRange;
 };
 
+//==============================================================================
+struct AirWindowsPlugin::CostCounter
+{
+    CostCounter (const juce::String& type) : pluginType (type) {}
+
+    void add (juce::int64 ticks, int numSamples) noexcept
+    {
+        totalTicks.fetch_add (ticks, std::memory_order_relaxed);
+        totalSamples.fetch_add (numSamples, std::memory_order_relaxed);
+    }
+
+    const juce::String pluginType;
+    std::atomic<juce::int64> totalTicks { 0 }, totalSamples { 0 };
+};
+
+/** Holds a counter for each algorithm. These are never removed, so the instances
+    can keep hold of a pointer to theirs and update it without locking.
+*/
+struct AirWindowsPlugin::CostRegistry
+{
+    static CostRegistry& getInstance()
+    {
+        static CostRegistry registry;
+        return registry;
+    }
+
+    CostCounter* getCounter (const juce::String& pluginType)
+    {
+        const juce::ScopedLock sl (lock);
+
+        for (auto c : counters)
+            if (c->pluginType == pluginType)
+                return c;
+
+        return counters.add (new CostCounter (pluginType));
+    }
+
+    juce::CriticalSection lock;
+    juce::OwnedArray<CostCounter> counters;
+};
+
+static std::atomic<bool> measuringAirWindowsCosts { false };
+
+juce::Array<AirWindowsPlugin::AlgorithmCost> AirWindowsPlugin::getAlgorithmCosts()
+{
+    auto& registry = CostRegistry::getInstance();
+    const juce::ScopedLock sl (registry.lock);
+
+    juce::Array<AlgorithmCost> costs;
+    auto nanosecondsPerTick = 1.0e9 / (double) juce::Time::getHighResolutionTicksPerSecond();
+
+    for (auto c : registry.counters)
+    {
+        auto numSamples = c->totalSamples.load (std::memory_order_relaxed);
+
+        if (numSamples > 0)
+            costs.add ({ c->pluginType,
+                         (double) c->totalTicks.load (std::memory_order_relaxed) * nanosecondsPerTick / (double) numSamples,
+                         numSamples });
+    }
+
+    std::sort (costs.begin(), costs.end(),
+               [] (const AlgorithmCost& a, const AlgorithmCost& b) { return a.nanosecondsPerSample > b.nanosecondsPerSample; });
+
+    return costs;
+}
+
+void AirWindowsPlugin::resetAlgorithmCosts()
+{
+    auto& registry = CostRegistry::getInstance();
+    const juce::ScopedLock sl (registry.lock);
+
+    for (auto c : registry.counters)
+    {
+        c->totalTicks = 0;
+        c->totalSamples = 0;
+    }
+}
+
+void AirWindowsPlugin::setMeasuringAlgorithmCosts (bool shouldMeasure)
+{
+    measuringAirWindowsCosts = shouldMeasure;
+}
+
+bool AirWindowsPlugin::isMeasuringAlgorithmCosts()
+{
+    return measuringAirWindowsCosts;
+}
+
 //==============================================================================
 AirWindowsPlugin::AirWindowsPlugin (PluginCreationInfo info, std::unique_ptr<AirWindowsBase> base)
     : Plugin (info), callback (*this), impl (std::move (base))
@@ -188,6 +277,9 @@ int AirWindowsPlugin::getNumOutputChannelsGivenInputs (int)
 void AirWindowsPlugin::initialise (const PlaybackInitialisationInfo& info)
 {
     sampleRate = info.sampleRate;
+
+    if (costCounter.load() == nullptr)
+        costCounter = CostRegistry::getInstance().getCounter (getPluginType());
 }
 
 void AirWindowsPlugin::deinitialise()
@@ -259,9 +351,11 @@ void AirWindowsPlugin::processBlock (juce::AudioBuffer<float>& buffer)
 
         input.buffer.copyFrom (0, 0, buffer, 0, 0, samps);
 
+        auto startTicks = getCostStartTicks();
         impl->processReplacing (input.buffer.getArrayOfWritePointers(),
                                 output.buffer.getArrayOfWritePointers(),
                                 samps);
+        addCost (startTicks, samps);
 
         buffer.copyFrom (0, 0, output.buffer, 0, 0, samps);
     }
@@ -270,15 +364,32 @@ void AirWindowsPlugin::processBlock (juce::AudioBuffer<float>& buffer)
         AudioScratchBuffer output (numChans, samps);
         output.buffer.clear();
 
+        auto startTicks = getCostStartTicks();
         impl->processReplacing (buffer.getArrayOfWritePointers(),
                                 output.buffer.getArrayOfWritePointers(),
                                 samps);
+        addCost (startTicks, samps);
 
         for (int i = 0; i < numChans; ++i)
             buffer.copyFrom (i, 0, output.buffer, i, 0, samps);
     }
 }
 
+juce::int64 AirWindowsPlugin::getCostStartTicks() const noexcept
+{
+    return measuringAirWindowsCosts.load (std::memory_order_relaxed) ? juce::Time::getHighResolutionTicks() : 0;
+}
+
+void AirWindowsPlugin::addCost (juce::int64 startTicks, int numSamples) noexcept
+{
+    // A block that started before measuring was turned on isn't counted
+    if (startTicks == 0)
+        return;
+
+    if (auto c = costCounter.load())
+        c->add (juce::Time::getHighResolutionTicks() - startTicks, numSamples);
+}
+
 void AirWindowsPlugin::restorePluginStateFromValueTree (const juce::ValueTree& v)
 {
     juce::ScopedLock sl (lock);
@@ -1072,5 +1183,141 @@ AirWindowsuLawDecode::AirWindowsuLawDecode (PluginCreationInfo info)
 AirWindowsuLawEncode::AirWindowsuLawEncode (PluginCreationInfo info)
     : AirWindowsPlugin (info, std::make_unique<airwindows::ulawencode::uLawEncode> (&callback)) {}
 
+//==============================================================================
+#if TRACKTION_UNIT_TESTS
+
+class AirWindowsBenchmarks  : public juce::UnitTest
+{
+public:
+    AirWindowsBenchmarks()
+        : juce::UnitTest ("AirWindows Benchmarks", "Tracktion:Longer") {}
+
+    //==============================================================================
+    void runTest() override
+    {
+        auto& engine = *Engine::getEngines()[0];
+        auto edit = Edit::createSingleTrackEdit (engine);
+
+        // The algorithms only need a plugin to ask for the sample rate
+        auto plugin = edit->getPluginCache().createNewPlugin (AirWindowsBussColors4::xmlTypeName, {});
+        auto owner = dynamic_cast<AirWindowsPlugin*> (plugin.get());
+        expect (owner != nullptr);
+
+        if (owner == nullptr)
+            return;
+
+        AirWindowsCallback callback (*owner);
+
+        beginTest ("BussColors4");
+        {
+            for (int console = 0; console < 8; ++console)
+            {
+                auto setUp = [console] (bool useReference)
+                {
+                    return [console, useReference] (airwindows::busscolors4::BussColors4& a)
+                    {
+                        a.setParameter (airwindows::busscolors4::kParamA, (console + 0.5f) / 8.0f);
+                        a.useReferenceConvolution = useReference;
+                    };
+                };
+
+                auto reference = process<airwindows::busscolors4::BussColors4> (callback, setUp (true));
+                auto vectorised = process<airwindows::busscolors4::BussColors4> (callback, setUp (false));
+
+                logMessage ("Console " + juce::String (console + 1) + ": "
+                             + juce::String (reference.nanosecondsPerSample, 1) + "ns per sample with the reference convolution, "
+                             + juce::String (vectorised.nanosecondsPerSample, 1) + "ns vectorised");
+
+                // The vectorised sums are rounded in a different order, which only
+                // changes the last bit or so of the double result
+                expectLessThan (getMaxDifference (reference.output, vectorised.output), 1.0e-6f);
+            }
+        }
+
+        beginTest ("Logical4");
+        {
+            auto result = process<airwindows::logical4::Logical4> (callback, [] (airwindows::logical4::Logical4&) {});
+            logMessage (juce::String (result.nanosecondsPerSample, 1) + "ns per sample");
+            expect (isFinite (result.output));
+        }
+
+        beginTest ("PocketVerbs");
+        {
+            auto result = process<airwindows::pocketverbs::PocketVerbs> (callback, [] (airwindows::pocketverbs::PocketVerbs&) {});
+            logMessage (juce::String (result.nanosecondsPerSample, 1) + "ns per sample");
+            expect (isFinite (result.output));
+        }
+    }
+
+private:
+    struct Result
+    {
+        juce::AudioBuffer<float> output;
+        double nanosecondsPerSample = 0.0;
+    };
+
+    template<typename AlgorithmType, typename SetUpFunction>
+    static Result process (AirWindowsCallback& callback, SetUpFunction&& setUp)
+    {
+        constexpr int blockSize = 256, numBlocks = 2000;
+
+        AlgorithmType algorithm (&callback);
+        setUp (algorithm);
+
+        juce::AudioBuffer<float> input (2, blockSize);
+        Result result;
+        result.output.setSize (2, blockSize * numBlocks);
+
+        // The input never gets near zero, so the algorithms' shared denormal noise
+        // isn't used, and the dither uses rand(), so each run starts from the same seed
+        juce::Random random (1234);
+        std::srand (1);
+        juce::int64 ticks = 0;
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                input.setSample (0, i, 0.3f + 0.25f * (random.nextFloat() - 0.5f));
+                input.setSample (1, i, -0.3f + 0.25f * (random.nextFloat() - 0.5f));
+            }
+
+            float* outputs[] = { result.output.getWritePointer (0, block * blockSize),
+                                 result.output.getWritePointer (1, block * blockSize) };
+
+            const auto startTicks = juce::Time::getHighResolutionTicks();
+            algorithm.processReplacing (input.getArrayOfWritePointers(), outputs, blockSize);
+            ticks += juce::Time::getHighResolutionTicks() - startTicks;
+        }
+
+        result.nanosecondsPerSample = juce::Time::highResolutionTicksToSeconds (ticks) * 1.0e9 / (blockSize * numBlocks);
+        return result;
+    }
+
+    static float getMaxDifference (const juce::AudioBuffer<float>& a, const juce::AudioBuffer<float>& b)
+    {
+        float maxDifference = 0.0f;
+
+        for (int c = 0; c < a.getNumChannels(); ++c)
+            for (int i = 0; i < a.getNumSamples(); ++i)
+                maxDifference = jmax (maxDifference, std::abs (a.getSample (c, i) - b.getSample (c, i)));
+
+        return maxDifference;
+    }
+
+    static bool isFinite (const juce::AudioBuffer<float>& buffer)
+    {
+        for (int c = 0; c < buffer.getNumChannels(); ++c)
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+                if (! std::isfinite (buffer.getSample (c, i)))
+                    return false;
+
+        return true;
+    }
+};
+
+static AirWindowsBenchmarks airWindowsBenchmarks;
+
+#endif // TRACKTION_UNIT_TESTS
 
 }
@@ -73,6 +73,33 @@ public:
     void restorePluginStateFromValueTree (const juce::ValueTree&) override;
     void flushPluginStateToValueTree() override;
 
+    //==============================================================================
+    /** The time spent running one of the AirWindows algorithms, summed over all its instances. */
+    struct AlgorithmCost
+    {
+        juce::String pluginType;                /**< The xmlTypeName of the algorithm. */
+        double nanosecondsPerSample = 0.0;      /**< The average time taken to process one sample frame. */
+        juce::int64 numSamples = 0;             /**< The number of sample frames that have been processed. */
+    };
+
+    /** Returns the cost of each algorithm that's been run since the last reset,
+        most expensive per sample first. This can be used to find the algorithms
+        that are worth optimising.
+        Nothing is measured unless setMeasuringAlgorithmCosts() has been turned on.
+    */
+    static juce::Array<AlgorithmCost> getAlgorithmCosts();
+
+    /** Turns the measurements returned by getAlgorithmCosts() on or off.
+        They're off by default, as they read the clock twice for every block.
+    */
+    static void setMeasuringAlgorithmCosts (bool shouldMeasure);
+
+    /** Returns true if the cost of each algorithm is being measured. */
+    static bool isMeasuringAlgorithmCosts();
+
+    /** Clears the measurements returned by getAlgorithmCosts(). */
+    static void resetAlgorithmCosts();
+
 protected:
     //==============================================================================
     friend AirWindowsAutomatableParameter;
@@ -80,6 +107,8 @@ protected:
 
     void setConversionRange (int param, juce::NormalisableRange<float> range);
     void processBlock (juce::AudioBuffer<float>& buffer);
+    juce::int64 getCostStartTicks() const noexcept;
+    void addCost (juce::int64 startTicks, int numSamples) noexcept;
 
     juce::CriticalSection lock;
     AirWindowsCallback callback;
@@ -95,6 +124,9 @@ public:
     AutomatableParameter::Ptr dryGain, wetGain;
 
 private:
+    struct CostCounter;
+    struct CostRegistry;
+    std::atomic<CostCounter*> costCounter { nullptr };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AirWindowsPlugin)
 };
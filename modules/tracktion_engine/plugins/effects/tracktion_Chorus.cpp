@@ -30,12 +30,28 @@ const char* ChorusPlugin::xmlTypeName = "chorus";
 
 void ChorusPlugin::initialise (const PlaybackInitialisationInfo& info)
 {
-    const float delayMs = 20.0f;
-    const int maxLengthMs = 1 + roundToInt (delayMs + depthMs);
-    int bufferSizeSamples = roundToInt ((maxLengthMs * info.sampleRate) / 1000.0);
+    const int bufferSizeSamples = getMaxLengthSamples (info.sampleRate);
+    phase = 0.0f;
+
+    idleSuspender.reset (info.sampleRate);
+    idleSuspender.setTailLength (getTailLength());
+
     delayBuffer.ensureMaxBufferSize (bufferSizeSamples);
     delayBuffer.clearBuffer();
-    phase = 0.0f;
+}
+
+int ChorusPlugin::getMaxLengthSamples (double rate) const
+{
+    const float delayMs = 20.0f;
+    const int maxLengthMs = 1 + roundToInt (delayMs + depthMs);
+    return roundToInt ((maxLengthMs * rate) / 1000.0);
+}
+
+double ChorusPlugin::getTailLength() const
+{
+    // there's no feedback so the tail is just the longest delay
+    const float delayMs = 20.0f;
+    return (1.0 + delayMs + depthMs.get()) / 1000.0;
 }
 
 void ChorusPlugin::deinitialise()
@@ -50,6 +66,14 @@ void ChorusPlugin::applyToBuffer (const AudioRenderContext& fc)
 
     SCOPED_REALTIME_CHECK
 
+    clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
+
+    idleSuspender.setTailLength (getTailLength());
+    const auto action = idleSuspender.getNextAction (*fc.destBuffer, 2, fc.bufferStartSample, fc.bufferNumSamples);
+
+    if (action == IdleSuspender::Action::skip)
+        return;
+
     float ph = 0.0f;
     int bufPos = 0;
 
@@ -57,19 +81,19 @@ void ChorusPlugin::applyToBuffer (const AudioRenderContext& fc)
     const float minSweepSamples = (float) ((delayMs * sampleRate) / 1000.0);
     const float maxSweepSamples = (float) (((delayMs + depthMs) * sampleRate) / 1000.0);
     const float speed = (float)((double_Pi * 2.0) / (sampleRate / speedHz));
-    const int maxLengthMs = 1 + roundToInt (delayMs + depthMs);
-    const int lengthInSamples = roundToInt ((maxLengthMs * sampleRate) / 1000.0);
+    const int lengthInSamples = getMaxLengthSamples (sampleRate);
 
     delayBuffer.ensureMaxBufferSize (lengthInSamples);
 
+    if (action == IdleSuspender::Action::wakeAndProcess)
+        delayBuffer.clearBuffer();
+
     const float feedbackGain = 0.0f; // xxx not sure why this value was here..
     const float lfoFactor = 0.5f * (maxSweepSamples - minSweepSamples);
     const float lfoOffset = minSweepSamples + lfoFactor;
 
     AudioFadeCurve::CrossfadeLevels wetDry (mixProportion);
 
-    clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
-
     for (int chan = jmin (2, fc.destBuffer->getNumChannels()); --chan >= 0;)
     {
         float* const d = fc.destBuffer->getWritePointer (chan, fc.bufferStartSample);
@@ -29,6 +29,7 @@ public:
     void initialise (const PlaybackInitialisationInfo&) override;
     void deinitialise() override;
     void applyToBuffer (const AudioRenderContext&) override;
+    double getTailLength() const override;
     juce::String getSelectableDescription() override    { return TRANS("Chorus Plugin"); }
     bool needsConstantBufferSize() override             { return false; }
 
@@ -40,6 +41,9 @@ private:
     //==============================================================================
     DelayBufferBase delayBuffer;
     float phase = 0;
+    IdleSuspender idleSuspender;
+
+    int getMaxLengthSamples (double rate) const;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChorusPlugin)
 };
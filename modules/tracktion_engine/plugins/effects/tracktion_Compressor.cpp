@@ -59,6 +59,14 @@ CompressorPlugin::CompressorPlugin (PluginCreationInfo info)  : Plugin (info)
 
     sidechainValue.referTo (state, IDs::inputDb, um);
     sidechainDb->attachToCurrentValue (sidechainValue);
+
+    lookAheadValue.referTo (state, IDs::lookAhead, um);
+
+    playbackRestartTimer.setCallback ([this]
+                                      {
+                                          edit.restartPlayback();
+                                          playbackRestartTimer.stopTimer();
+                                      });
 }
 
 CompressorPlugin::~CompressorPlugin()
@@ -85,14 +93,72 @@ void CompressorPlugin::getChannelNames (StringArray* ins, StringArray* outs)
 
 void CompressorPlugin::initialise (const PlaybackInitialisationInfo&)
 {
-    currentLevel = 0.0;
+    currentLevel = 0.0f;
     lastSamp = 0.0f;
+    lastAttackMs = -1.0f;
+    lastReleaseMs = -1.0f;
+
+    levels.setSize (1, jmax (1, blockSizeSamples));
+
+    lookAheadSamples = getLookAheadSamples();
+    lookAheadPos = 0;
+    lookAheadBuffer.setSize (2, jmax (1, lookAheadSamples));
+    lookAheadBuffer.clear();
 }
 
 void CompressorPlugin::deinitialise()
 {
 }
 
+int CompressorPlugin::getLookAheadSamples() const
+{
+    return roundToInt (jlimit (0.0f, getMaxLookAheadMs(), lookAheadValue.get()) * sampleRate / 1000.0);
+}
+
+double CompressorPlugin::getLatencySeconds()
+{
+    return getLookAheadSamples() / sampleRate;
+}
+
+void CompressorPlugin::updateEnvelopeFactors()
+{
+    const float attack = attackMs->getCurrentValue();
+    const float release = releaseMs->getCurrentValue();
+
+    if (attack != lastAttackMs || release != lastReleaseMs)
+    {
+        lastAttackMs = attack;
+        lastReleaseMs = release;
+
+        const double logThreshold = std::log10 (0.01);
+        attackFactor  = (float) std::pow (10.0, logThreshold / (attack * sampleRate / 1000.0));
+        releaseFactor = (float) std::pow (10.0, logThreshold / (release * sampleRate / 1000.0));
+    }
+}
+
+void CompressorPlugin::applyLookAhead (AudioBuffer<float>& buffer, int numChannels, int startSample, int numSamples)
+{
+    // Swapping the block with the delay line leaves the delayed audio in the block and
+    // the new audio in the line, a section at a time so it can be vectorised
+    int pos = lookAheadPos;
+
+    for (int done = 0; done < numSamples;)
+    {
+        const int num = jmin (numSamples - done, lookAheadSamples - pos);
+
+        for (int chan = 0; chan < numChannels; ++chan)
+        {
+            auto data = buffer.getWritePointer (chan, startSample + done);
+            std::swap_ranges (data, data + num, lookAheadBuffer.getWritePointer (chan, pos));
+        }
+
+        done += num;
+        pos = (pos + num) % lookAheadSamples;
+    }
+
+    lookAheadPos = pos;
+}
+
 static const float preFilterAmount = 0.9f; // more = smoother level detection
 
 void CompressorPlugin::applyToBuffer (const AudioRenderContext& fc)
@@ -101,90 +167,93 @@ void CompressorPlugin::applyToBuffer (const AudioRenderContext& fc)
         return;
 
     SCOPED_REALTIME_CHECK
+    ScopedNoDenormals noDenormals;
+
+    updateEnvelopeFactors();
+
+    auto& buffer = *fc.destBuffer;
+    const int startSample = fc.bufferStartSample;
+    const int numSamples = fc.bufferNumSamples;
+    const int numChannels = jmin (2, buffer.getNumChannels());
 
-    const double logThreshold = std::log10 (0.01);
-    const double attackFactor = std::pow (10.0, logThreshold / (attackMs->getCurrentValue() * sampleRate / 1000.0));
-    const double releaseFactor = std::pow (10.0, logThreshold / (releaseMs->getCurrentValue() * sampleRate / 1000.0));
     const float outputGain = dbToGain (outputDb->getCurrentValue());
     const float thresh = thresholdGain->getCurrentValue();
     const float rat = ratio->getCurrentValue();
-    const bool useSidechain = useSidechainTrigger.get();
-    const float sidechainGain = dbToGain (sidechainDb->getCurrentValue());
 
-    float* b1 = fc.destBuffer->getWritePointer (0, fc.bufferStartSample);
+    // levels is sized in initialise, so anything longer is done a section at a time
+    const int maxSectionSize = levels.getNumSamples();
 
-    if (fc.destBuffer->getNumChannels() >= 2)
+    for (int done = 0; done < numSamples;)
     {
-        float* b2 = fc.destBuffer->getWritePointer (1, fc.bufferStartSample);
-        float* b3 = fc.destBuffer->getNumChannels() > 2 ? fc.destBuffer->getWritePointer (2, fc.bufferStartSample) : nullptr;
+        const int num = jmin (numSamples - done, maxSectionSize);
+        processSection (buffer, numChannels, startSample + done, num, outputGain, thresh, rat);
+        done += num;
+    }
 
-        for (int i = fc.bufferNumSamples; --i >= 0;)
-        {
-            float samp1 = *b1 + 1.0f;
-            samp1 -= 1.0f;
-            float samp2 = *b2 + 1.0f;
-            samp2 -= 1.0f;
-
-            float sampAvg = 0.0f;
-
-            if (useSidechain && b3 != nullptr)
-            {
-                sampAvg = lastSamp * preFilterAmount
-                            + std::abs (*b3++ * sidechainGain) * ((1.0f - preFilterAmount));
-            }
-            else
-            {
-                sampAvg = lastSamp * preFilterAmount
-                            + std::abs (samp1 + samp2) * ((1.0f - preFilterAmount) * 0.5f);
-            }
-
-            JUCE_UNDENORMALISE (sampAvg);
-
-            lastSamp = sampAvg;
-
-            if (sampAvg > thresh)
-                currentLevel = (currentLevel - sampAvg) * attackFactor + sampAvg;
-            else
-                currentLevel = (currentLevel - sampAvg) * releaseFactor + sampAvg;
-
-            float r = outputGain;
-
-            if (currentLevel > thresh)
-            {
-                r *= (float)((thresh + (currentLevel - thresh) * rat)
-                              / currentLevel);
-            }
-
-            *b1++ = samp1 * r;
-            *b2++ = samp2 * r;
-        }
+    clearChannels (buffer, 2, -1, startSample, numSamples);
+}
+
+void CompressorPlugin::processSection (AudioBuffer<float>& buffer, int numChannels, int startSample, int numSamples,
+                                       float outputGain, float thresh, float rat)
+{
+    jassert (numSamples <= levels.getNumSamples());
+    auto level = levels.getWritePointer (0);
+
+    // Rectify the detector input, already scaled for the pre-filter
+    if (useSidechainTrigger.get() && buffer.getNumChannels() > 2)
+    {
+        const float sidechainGain = dbToGain (sidechainDb->getCurrentValue());
+        FloatVectorOperations::copyWithMultiply (level, buffer.getReadPointer (2, startSample),
+                                                 sidechainGain * (1.0f - preFilterAmount), numSamples);
+    }
+    else if (numChannels == 2)
+    {
+        FloatVectorOperations::add (level, buffer.getReadPointer (0, startSample),
+                                    buffer.getReadPointer (1, startSample), numSamples);
+        FloatVectorOperations::multiply (level, (1.0f - preFilterAmount) * 0.5f, numSamples);
     }
     else
     {
-        for (int i = fc.bufferNumSamples; --i >= 0;)
-        {
-            const float samp = *b1;
-            const float sampAvg = lastSamp * preFilterAmount
-                                    + std::abs (samp) * (1.0f - preFilterAmount);
-            lastSamp = sampAvg;
+        FloatVectorOperations::copyWithMultiply (level, buffer.getReadPointer (0, startSample),
+                                                 1.0f - preFilterAmount, numSamples);
+    }
 
-            JUCE_UNDENORMALISE (lastSamp);
+    FloatVectorOperations::abs (level, level, numSamples);
 
-            if (sampAvg > thresh)
-                currentLevel = (currentLevel - sampAvg) * attackFactor + sampAvg;
-            else
-                currentLevel = (currentLevel - sampAvg) * releaseFactor + sampAvg;
+    // The envelope is the only part that depends on the previous sample
+    {
+        float sampAvg = lastSamp;
+        float env = currentLevel;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            sampAvg = sampAvg * preFilterAmount + level[i];
+            env = (env - sampAvg) * (sampAvg > thresh ? attackFactor : releaseFactor) + sampAvg;
+            level[i] = env;
+        }
 
-            float r = outputGain;
+        JUCE_UNDENORMALISE (sampAvg);
+        JUCE_UNDENORMALISE (env);
+        lastSamp = sampAvg;
+        currentLevel = env;
+    }
 
-            if (currentLevel > thresh)
-                r *= (float)((thresh + (currentLevel - thresh) * rat) / currentLevel);
+    // Above the threshold the output level is thresh + (level - thresh) * ratio, which as a
+    // gain is ratio + thresh * (1 - ratio) / level. Clamping the level to the threshold makes
+    // that 1 below it, so there's no branch
+    {
+        FloatVectorOperations::max (level, level, thresh, numSamples);
+        const float threshTimesOneMinusRatio = thresh * (1.0f - rat);
 
-            *b1++ = samp * r;
-        }
+        for (int i = 0; i < numSamples; ++i)
+            level[i] = outputGain * (rat + threshTimesOneMinusRatio / level[i]);
     }
 
-    clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
+    if (lookAheadSamples > 0)
+        applyLookAhead (buffer, numChannels, startSample, numSamples);
+
+    for (int chan = 0; chan < numChannels; ++chan)
+        FloatVectorOperations::multiply (buffer.getWritePointer (chan, startSample), level, numSamples);
 }
 
 float CompressorPlugin::getThreshold() const
@@ -209,7 +278,7 @@ void CompressorPlugin::setRatio (float r)
 
 void CompressorPlugin::restorePluginStateFromValueTree (const juce::ValueTree& v)
 {
-    CachedValue<float>* cvsFloat[]  = { &thresholdValue, &ratioValue, &attackValue, &releaseValue, &outputValue, &sidechainValue, nullptr };
+    CachedValue<float>* cvsFloat[]  = { &thresholdValue, &ratioValue, &attackValue, &releaseValue, &outputValue, &sidechainValue, &lookAheadValue, nullptr };
     CachedValue<bool>* cvsBool[]    = { &useSidechainTrigger, nullptr };
     copyPropertiesToNullTerminatedCachedValues (v, cvsFloat);
     copyPropertiesToNullTerminatedCachedValues (v, cvsBool);
@@ -223,6 +292,9 @@ void CompressorPlugin::valueTreePropertyChanged (ValueTree& v, const juce::Ident
     if (v == state && id == IDs::sidechainTrigger)
         propertiesChanged();
 
+    if (v == state && id == IDs::lookAhead)
+        playbackRestartTimer.startTimer (50);
+
     Plugin::valueTreePropertyChanged (v, id);
 }
 
@@ -37,12 +37,19 @@ public:
     void initialise (const PlaybackInitialisationInfo&) override;
     void deinitialise() override;
     void applyToBuffer (const AudioRenderContext&) override;
+    double getLatencySeconds() override;
 
     juce::String getSelectableDescription() override                    { return TRANS("Compressor/Limiter Plugin"); }
 
     juce::CachedValue<float> thresholdValue, ratioValue, attackValue,
                              releaseValue, outputValue, sidechainValue;
     juce::CachedValue<bool> useSidechainTrigger;
+
+    /** The time in milliseconds the audio is delayed by so that the gain can react to
+        peaks before they arrive. This is reported as latency so it's compensated for.
+        Changing it restarts playback.
+    */
+    juce::CachedValue<float> lookAheadValue;
     AutomatableParameter::Ptr thresholdGain, ratio, attackMs,
                               releaseMs, outputDb, sidechainDb;
 
@@ -50,11 +57,24 @@ public:
 
     static float getMinThreshold()      { return 0.01f; }
     static float getMaxThreshold()      { return 1.0f; }
+    static float getMaxLookAheadMs()    { return 10.0f; }
 
 private:
-    double currentLevel = 0.0;
+    float currentLevel = 0.0f;
     float lastSamp = 0.0f;
 
+    float attackFactor = 0.0f, releaseFactor = 0.0f;
+    float lastAttackMs = -1.0f, lastReleaseMs = -1.0f;
+    juce::AudioBuffer<float> levels, lookAheadBuffer;
+    int lookAheadSamples = 0, lookAheadPos = 0;
+    LambdaTimer playbackRestartTimer;
+
+    int getLookAheadSamples() const;
+    void updateEnvelopeFactors();
+    void applyLookAhead (juce::AudioBuffer<float>&, int numChannels, int startSample, int numSamples);
+    void processSection (juce::AudioBuffer<float>&, int numChannels, int startSample, int numSamples,
+                         float outputGain, float thresh, float ratio);
+
     void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CompressorPlugin)
@@ -43,6 +43,9 @@ const char* DelayPlugin::xmlTypeName = "delay";
 
 void DelayPlugin::initialise (const PlaybackInitialisationInfo& info)
 {
+    idleSuspender.reset (info.sampleRate);
+    idleSuspender.setTailLength (getTailLength());
+
     const int lengthInSamples = (int) (lengthMs * info.sampleRate / 1000.0);
     delayBuffer.ensureMaxBufferSize (lengthInSamples);
     delayBuffer.clearBuffer();
@@ -58,6 +61,21 @@ void DelayPlugin::reset()
     delayBuffer.clearBuffer();
 }
 
+double DelayPlugin::getTailLength() const
+{
+    const float feedback = feedbackDb->getCurrentValue();
+    const double length = lengthMs.get() / 1000.0;
+
+    if (feedback <= getMinDelayFeedbackDb())
+        return length;
+
+    if (feedback >= 0.0f)
+        return std::numeric_limits<double>::infinity();
+
+    // each repeat is quieter by the feedback, so this is how long the repeats take to fall by 80dB
+    return length * (1.0 + 80.0 / -feedback);
+}
+
 void DelayPlugin::applyToBuffer (const AudioRenderContext& fc)
 {
     if (fc.destBuffer == nullptr)
@@ -65,6 +83,14 @@ void DelayPlugin::applyToBuffer (const AudioRenderContext& fc)
 
     SCOPED_REALTIME_CHECK
 
+    clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
+
+    idleSuspender.setTailLength (getTailLength());
+    const auto action = idleSuspender.getNextAction (*fc.destBuffer, 2, fc.bufferStartSample, fc.bufferNumSamples);
+
+    if (action == IdleSuspender::Action::skip)
+        return;
+
     const float feedbackGain = feedbackDb->getCurrentValue() > getMinDelayFeedbackDb()
                                   ? dbToGain (feedbackDb->getCurrentValue()) : 0.0f;
 
@@ -73,9 +99,11 @@ void DelayPlugin::applyToBuffer (const AudioRenderContext& fc)
     const int lengthInSamples = (int) (lengthMs * sampleRate / 1000.0);
     delayBuffer.ensureMaxBufferSize (lengthInSamples);
 
-    const int offset = delayBuffer.bufferPos;
+    // anything left in the buffer from before it was suspended has already been heard
+    if (action == IdleSuspender::Action::wakeAndProcess)
+        delayBuffer.clearBuffer();
 
-    clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
+    const int offset = delayBuffer.bufferPos;
 
     for (int chan = jmin (2, fc.destBuffer->getNumChannels()); --chan >= 0;)
     {
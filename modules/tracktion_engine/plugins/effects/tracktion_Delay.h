@@ -71,6 +71,7 @@ public:
     void deinitialise() override;
     void reset() override;
     void applyToBuffer (const AudioRenderContext&) override;
+    double getTailLength() const override;
 
     void restorePluginStateFromValueTree (const juce::ValueTree&) override;
 
@@ -84,6 +85,7 @@ public:
 
 private:
     DelayBufferBase delayBuffer;
+    IdleSuspender idleSuspender;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DelayPlugin)
 };
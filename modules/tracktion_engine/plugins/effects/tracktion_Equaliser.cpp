@@ -197,70 +197,54 @@ void EqualiserPlugin::updateIIRFilters()
 {
     const ScopedLock sl (filterLock);
 
-    if (needToUpdateFilters[0])
+    auto updateBand = [this] (int band, AutomatableParameter& gain, IIRCoefficients c)
     {
-        needToUpdateFilters[0] = false;
-
-        IIRCoefficients c = IIRCoefficients::makeLowShelf (lastSampleRate, loFreq->getCurrentValue(), loQ->getCurrentValue(),
-                                                           convertEQLevelToGain (loGain->getCurrentValue()));
-
-        for (int i = EQ_CHANS; --i >= 0;)
-            low[i].setCoefficients (c);
-    }
-
-    if (needToUpdateFilters[1])
-    {
-        needToUpdateFilters[1] = false;
-
-        IIRCoefficients c = IIRCoefficients::makePeakFilter (lastSampleRate, midFreq1->getCurrentValue(), midQ1->getCurrentValue(),
-                                                             convertEQLevelToGain (midGain1->getCurrentValue()));
-
-        for (int i = EQ_CHANS; --i >= 0;)
-            mid1[i].setCoefficients (c);
-    }
-
-    if (needToUpdateFilters[2])
-    {
-        needToUpdateFilters[2] = false;
-
-        IIRCoefficients c = IIRCoefficients::makePeakFilter (lastSampleRate, midFreq2->getCurrentValue(), midQ2->getCurrentValue(),
-                                                             convertEQLevelToGain (midGain2->getCurrentValue()));
-
-        for (int i = EQ_CHANS; --i >= 0;)
-            mid2[i].setCoefficients (c);
-    }
-
-    if (needToUpdateFilters[3])
-    {
-        needToUpdateFilters[3] = false;
-
-        IIRCoefficients c = IIRCoefficients::makeHighShelf (lastSampleRate, hiFreq->getCurrentValue(), hiQ->getCurrentValue(),
-                                                            convertEQLevelToGain (hiGain->getCurrentValue()));
-
-        for (int i = EQ_CHANS; --i >= 0;)
-            high[i].setCoefficients (c);
-    }
+        needToUpdateFilters[band] = false;
+        bandCoefficients[band] = c;
+
+        if (gain.getCurrentValue() != 0)
+            filters.setCoefficients (band, c);
+        else
+            filters.setStageBypassed (band);
+    };
+
+    if (needToUpdateFilters[lowBand])
+        updateBand (lowBand, *loGain,
+                    IIRCoefficients::makeLowShelf (lastSampleRate, loFreq->getCurrentValue(), loQ->getCurrentValue(),
+                                                   convertEQLevelToGain (loGain->getCurrentValue())));
+
+    if (needToUpdateFilters[midBand1])
+        updateBand (midBand1, *midGain1,
+                    IIRCoefficients::makePeakFilter (lastSampleRate, midFreq1->getCurrentValue(), midQ1->getCurrentValue(),
+                                                     convertEQLevelToGain (midGain1->getCurrentValue())));
+
+    if (needToUpdateFilters[midBand2])
+        updateBand (midBand2, *midGain2,
+                    IIRCoefficients::makePeakFilter (lastSampleRate, midFreq2->getCurrentValue(), midQ2->getCurrentValue(),
+                                                     convertEQLevelToGain (midGain2->getCurrentValue())));
+
+    if (needToUpdateFilters[highBand])
+        updateBand (highBand, *hiGain,
+                    IIRCoefficients::makeHighShelf (lastSampleRate, hiFreq->getCurrentValue(), hiQ->getCurrentValue(),
+                                                    convertEQLevelToGain (hiGain->getCurrentValue())));
 }
 
 void EqualiserPlugin::initialise (const PlaybackInitialisationInfo&)
 {
-    for (int i = EQ_CHANS; --i >= 0;)
-    {
-        low[i].reset();
-        mid1[i].reset();
-        mid2[i].reset();
-        high[i].reset();
-    }
+    const ScopedLock sl (filterLock);
+
+    filters.prepare (sampleRate, EQ_CHANS);
 
     if (lastSampleRate != sampleRate)
         curveNeedsUpdating = true;
 
     lastSampleRate = (float)sampleRate;
 
-    for (int i = 4; --i >= 0;)
+    for (int i = numBands; --i >= 0;)
         needToUpdateFilters[i] = true;
 
     updateIIRFilters();
+    filters.skipSmoothing();
 }
 
 void EqualiserPlugin::deinitialise()
@@ -283,15 +267,7 @@ void EqualiserPlugin::applyToBuffer (const AudioRenderContext& fc)
 
         addAntiDenormalisationNoise (*fc.destBuffer, fc.bufferStartSample, fc.bufferNumSamples);
 
-        for (int i = jmin ((int) EQ_CHANS, fc.destBuffer->getNumChannels()); --i >= 0;)
-        {
-            float* const data = fc.destBuffer->getWritePointer (i, fc.bufferStartSample);
-
-            if (loGain->getCurrentValue() != 0)       low[i] .processSamples (data, fc.bufferNumSamples);
-            if (midGain1->getCurrentValue() != 0)     mid1[i].processSamples (data, fc.bufferNumSamples);
-            if (midGain2->getCurrentValue() != 0)     mid2[i].processSamples (data, fc.bufferNumSamples);
-            if (hiGain->getCurrentValue() != 0)       high[i].processSamples (data, fc.bufferNumSamples);
-        }
+        filters.process (*fc.destBuffer, fc.bufferStartSample, fc.bufferNumSamples);
 
         if (phaseInvert)
             fc.destBuffer->applyGain (fc.bufferStartSample, fc.bufferNumSamples, -1.0f);
@@ -316,10 +292,17 @@ float EqualiserPlugin::getDBGainAtFrequency (float f)
         zeromem (samps, sizeof (samps));
         samps[0] = 1.0f;
 
-        if (loGain->getCurrentValue() != 0)     IIRFilter (low[0]) .processSamples (samps, sampSize);
-        if (midGain1->getCurrentValue() != 0)   IIRFilter (mid1[0]).processSamples (samps, sampSize);
-        if (midGain2->getCurrentValue() != 0)   IIRFilter (mid2[0]).processSamples (samps, sampSize);
-        if (hiGain->getCurrentValue() != 0)     IIRFilter (high[0]).processSamples (samps, sampSize);
+        AutomatableParameter* gains[] = { loGain.get(), midGain1.get(), midGain2.get(), hiGain.get() };
+
+        for (int band = 0; band < numBands; ++band)
+        {
+            if (gains[band]->getCurrentValue() != 0)
+            {
+                IIRFilter filter;
+                filter.setCoefficients (bandCoefficients[band]);
+                filter.processSamples (samps, sampSize);
+            }
+        }
 
         fft.performRealOnlyForwardTransform (samps);
 
@@ -82,7 +82,9 @@ private:
     bool curveNeedsUpdating = true;
 
     enum { EQ_CHANS = 2 };
-    juce::IIRFilter low[EQ_CHANS], mid1[EQ_CHANS], mid2[EQ_CHANS], high[EQ_CHANS];
+    enum { lowBand, midBand1, midBand2, highBand, numBands };
+    BiquadCascade filters { numBands };
+    juce::IIRCoefficients bandCoefficients[numBands];
 
     enum { fftOrder = 10 };
     juce::dsp::FFT fft { fftOrder };
@@ -280,10 +280,18 @@ private:
 class FourOscVoice : public MPESynthesiserVoice
 {
 public:
-    FourOscVoice (FourOscPlugin& s) : synth (s)
+    FourOscVoice (FourOscPlugin& s) : synth (s), params (s)
     {
-        for (auto p : synth.getAutomatableParameters())
-            smoothers[p] = {};
+        smoothers.resize ((size_t) synth.getNumAutomatableParameters());
+        setMaxBlockSize (synth.getMaxBlockSize());
+    }
+
+    void setMaxBlockSize (int numSamples)
+    {
+        renderBuffer.setSize (2, jmax (1, numSamples), false, false, true);
+
+        for (auto& o : oscillators)
+            o.setMaxBlockSize (numSamples);
     }
 
     void noteStarted() override
@@ -382,12 +390,12 @@ public:
             lfo1.setSampleRate (newRate);
             lfo2.setSampleRate (newRate);
 
-            lastLegato = paramValue (synth.legato);
-            activeNote.reset (newRate, paramValue (synth.legato) / 1000.0f);
+            lastLegato = paramValue (params.legato);
+            activeNote.reset (newRate, paramValue (params.legato) / 1000.0f);
             filterFrequencySmoother.reset (newRate, 0.05f);
 
-            for (auto& itr : smoothers)
-                itr.second.reset (newRate, 0.01f);
+            for (auto& smoother : smoothers)
+                smoother.reset (newRate, 0.01f);
         }
     }
 
@@ -399,6 +407,17 @@ public:
 
     void renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override
     {
+        // renderBuffer is sized up front by setMaxBlockSize, so render anything longer in pieces
+        const int maxChunk = renderBuffer.getNumSamples();
+
+        if (numSamples > maxChunk)
+        {
+            for (int done = 0; done < numSamples && isActive(); done += maxChunk)
+                renderNextBlock (outputBuffer, startSample + done, jmin (maxChunk, numSamples - done));
+
+            return;
+        }
+
         ScopedValueSetter<bool> svs (snapAllValues, firstBlock ? true : snapAllValues);
 
         updateParams (numSamples);
@@ -409,17 +428,14 @@ public:
             firstBlock = false;
         }
 
-        if (numSamples > renderBuffer.getNumSamples())
-            renderBuffer.setSize (2, numSamples, false, false, true);
-
-        renderBuffer.clear();
+        renderBuffer.clear (0, numSamples);
 
         // Run oscillators
         for (auto& o : oscillators)
             o.process (renderBuffer, 0, numSamples);
 
         // Apply velocity
-        float velocityGain = velocityToGain (currentlyPlayingNote.noteOnVelocity.asUnsignedFloat(), paramValue (synth.ampVelocity) / 100.0f);
+        float velocityGain = velocityToGain (currentlyPlayingNote.noteOnVelocity.asUnsignedFloat(), paramValue (params.ampVelocity) / 100.0f);
         velocityGain = jlimit (0.0f, 1.0f, velocityGain);
         renderBuffer.applyGain (velocityGain);
 
@@ -469,29 +485,14 @@ public:
             }
         }
 
-        for (auto& itr : smoothers)
-            itr.second.process (numSamples);
-    }
-
-    void applyEnvelopeToBuffer (ADSR& adsr, AudioSampleBuffer& buffer, int startSample, int numSamples)
-    {
-        float* l = buffer.getWritePointer (0, startSample);
-        float* r = buffer.getWritePointer (1, startSample);
-
-        while (--numSamples >= 0)
-        {
-            float db = adsr.getNextSample() * 100.0f - 100.0f;
-            float gain = Decibels::decibelsToGain (db);
-
-            *l++ *= gain;
-            *r++ *= gain;
-        }
+        for (auto& smoother : smoothers)
+            smoother.process (numSamples);
     }
 
     void getLiveModulationPositions (AutomatableParameter::Ptr param, Array<float>& positions)
     {
         if (isActive())
-            positions.add (param->valueRange.convertTo0to1 (paramValue (param)));
+            positions.add (param->valueRange.convertTo0to1 (paramValue (synth.resolveParameter (param.get()))));
     }
 
     void getLiveFilterFrequency (Array<float>& positions)
@@ -527,30 +528,30 @@ public:
 
         // Mod
         modAdsr1.setParameters ({
-            paramValue (synth.modEnvParams[0]->modAttack),
-            paramValue (synth.modEnvParams[0]->modDecay),
-            paramValue (synth.modEnvParams[0]->modSustain) / 100.0f,
-            paramValue (synth.modEnvParams[0]->modRelease),
+            paramValue (params.modEnv[0].modAttack),
+            paramValue (params.modEnv[0].modDecay),
+            paramValue (params.modEnv[0].modSustain) / 100.0f,
+            paramValue (params.modEnv[0].modRelease),
         });
 
         modAdsr2.setParameters ({
-            paramValue (synth.modEnvParams[1]->modAttack),
-            paramValue (synth.modEnvParams[1]->modDecay),
-            paramValue (synth.modEnvParams[1]->modSustain) / 100.0f,
-            paramValue (synth.modEnvParams[1]->modRelease),
+            paramValue (params.modEnv[1].modAttack),
+            paramValue (params.modEnv[1].modDecay),
+            paramValue (params.modEnv[1].modSustain) / 100.0f,
+            paramValue (params.modEnv[1].modRelease),
         });
 
         float lfoFreq1;
         if (synth.lfoParams[0]->syncValue)
             lfoFreq1 = 1.0f / ((synth.lfoParams[0]->beatValue.get()) / (synth.getCurrentTempo() / 60.0f));
         else
-            lfoFreq1 = paramValue (synth.lfoParams[0]->rate);
+            lfoFreq1 = paramValue (params.lfo[0].rate);
 
         lfo1.setParameters ({
             lfoFreq1,
             0,
             0,
-            paramValue (synth.lfoParams[0]->depth),
+            paramValue (params.lfo[0].depth),
             (SimpleLFO::WaveShape) synth.lfoParams[0]->waveShapeValue.get(),
             0.5f
         });
@@ -559,13 +560,13 @@ public:
         if (synth.lfoParams[1]->syncValue)
             lfoFreq2 = 1.0f / ((synth.lfoParams[1]->beatValue.get()) / (synth.getCurrentTempo() / 60.0f));
         else
-            lfoFreq2 = paramValue (synth.lfoParams[1]->rate);
+            lfoFreq2 = paramValue (params.lfo[1].rate);
 
         lfo2.setParameters ({
             lfoFreq2,
             0,
             0,
-            paramValue (synth.lfoParams[1]->depth) / 2,
+            paramValue (params.lfo[1].depth) / 2,
             (SimpleLFO::WaveShape) synth.lfoParams[1]->waveShapeValue.get(),
             0.5f
         });
@@ -574,23 +575,23 @@ public:
         ampAdsr.setAnalog (synth.ampAnalogValue);
 
         ampAdsr.setParameters ({
-            paramValue (synth.ampAttack),
-            paramValue (synth.ampDecay),
-            paramValue (synth.ampSustain) / 100.0f,
-            isQuickStop ? jmin (0.01f, paramValue (synth.ampRelease)) : paramValue (synth.ampRelease)
+            paramValue (params.ampAttack),
+            paramValue (params.ampDecay),
+            paramValue (params.ampSustain) / 100.0f,
+            isQuickStop ? jmin (0.01f, paramValue (params.ampRelease)) : paramValue (params.ampRelease)
         });
 
         // Filter
         filterAdsr.setParameters ({
-            paramValue (synth.filterAttack),
-            paramValue (synth.filterDecay),
-            paramValue (synth.filterSustain) / 100.0f,
-            paramValue (synth.filterRelease)
+            paramValue (params.filterAttack),
+            paramValue (params.filterDecay),
+            paramValue (params.filterSustain) / 100.0f,
+            paramValue (params.filterRelease)
         });
 
         int type = synth.filterTypeValue;
         float filterEnv = filterAdsr.getEnvelopeValue();
-        float filterSens = paramValue (synth.filterVelocity) / 100.0f;
+        float filterSens = paramValue (params.filterVelocity) / 100.0f;
         filterSens = currentlyPlayingNote.noteOnVelocity.asUnsignedFloat() * filterSens + 1.0f - filterSens;
         filterEnv *= filterSens;
 
@@ -602,9 +603,9 @@ public:
             return 440.0f * std::pow (2.0f, (noteNumber - 69) / 12.0f);
         };
 
-        float freqNote = paramValue (synth.filterFreq);
-        freqNote += (currentlyPlayingNote.initialNote - 60) * paramValue (synth.filterKey) / 100.0f;
-        freqNote += filterEnv * (paramValue (synth.filterAmount) * 137);
+        float freqNote = paramValue (params.filterFreq);
+        freqNote += (currentlyPlayingNote.initialNote - 60) * paramValue (params.filterKey) / 100.0f;
+        freqNote += filterEnv * (paramValue (params.filterAmount) * 137);
 
         filterFrequencySmoother.setValue (freqNote / 135.076232f);
         if (snapAllValues)
@@ -614,7 +615,7 @@ public:
         filterFrequencySmoother.process (numSamples);
 
         lastFilterFreq = jlimit (8.0f, jmin (20000.0f, float (currentSampleRate) / 2.0f), getMidiNoteInHertz (freqNote));
-        float q = 0.70710678118655f / (1.0f - (paramValue (synth.filterResonance) / 100.0f) * 0.99f);
+        float q = 0.70710678118655f / (1.0f - (paramValue (params.filterResonance) / 100.0f) * 0.99f);
 
         if (type != 0)
         {
@@ -656,23 +657,23 @@ public:
         for (auto& o : oscillators)
         {
             double note = activeNoteSmoothed + currentlyPlayingNote.totalPitchbendInSemitones;
-            note += roundToInt (paramValue (synth.oscParams[idx]->tune)) + paramValue (synth.oscParams[idx]->fineTune) / 100.0;
+            note += roundToInt (paramValue (params.osc[idx].tune)) + paramValue (params.osc[idx].fineTune) / 100.0;
 
             o.setNote (float (note));
-            o.setGain (Decibels::decibelsToGain (paramValue (synth.oscParams[idx]->level)));
+            o.setGain (Decibels::decibelsToGain (paramValue (params.osc[idx].level)));
             o.setWave ((Oscillator::Waves)(int (synth.oscParams[idx]->waveShapeValue.get())));
-            o.setPulseWidth (paramValue (synth.oscParams[idx]->pulseWidth));
+            o.setPulseWidth (paramValue (params.osc[idx].pulseWidth));
             o.setNumVoices (synth.oscParams[idx]->voicesValue);
-            o.setDetune (paramValue (synth.oscParams[idx]->detune));
-            o.setSpread (paramValue (synth.oscParams[idx]->spread) / 100.0f);
-            o.setPan (paramValue (synth.oscParams[idx]->pan));
+            o.setDetune (paramValue (params.osc[idx].detune));
+            o.setSpread (paramValue (params.osc[idx].spread) / 100.0f);
+            o.setPan (paramValue (params.osc[idx].pan));
 
             idx++;
         }
 
-        if (lastLegato != paramValue (synth.legato) && ! activeNote.isSmoothing())
+        if (lastLegato != paramValue (params.legato) && ! activeNote.isSmoothing())
         {
-            lastLegato = paramValue (synth.legato);
+            lastLegato = paramValue (params.legato);
             activeNote.reset (currentSampleRate, lastLegato / 1000.0f);
         }
     }
@@ -683,31 +684,84 @@ public:
     void noteKeyStateChanged() override     {}
 
 private:
-    float paramValue (AutomatableParameter::Ptr param)
+    using ResolvedParam = FourOscPlugin::ResolvedParam;
+
+    /** The synth's parameters, looked up once when the voice is created. */
+    struct ResolvedParams
+    {
+        ResolvedParams (FourOscPlugin& s)
+            : ampAttack (s.resolveParameter (s.ampAttack.get())),
+              ampDecay (s.resolveParameter (s.ampDecay.get())),
+              ampSustain (s.resolveParameter (s.ampSustain.get())),
+              ampRelease (s.resolveParameter (s.ampRelease.get())),
+              ampVelocity (s.resolveParameter (s.ampVelocity.get())),
+              filterAttack (s.resolveParameter (s.filterAttack.get())),
+              filterDecay (s.resolveParameter (s.filterDecay.get())),
+              filterSustain (s.resolveParameter (s.filterSustain.get())),
+              filterRelease (s.resolveParameter (s.filterRelease.get())),
+              filterFreq (s.resolveParameter (s.filterFreq.get())),
+              filterResonance (s.resolveParameter (s.filterResonance.get())),
+              filterAmount (s.resolveParameter (s.filterAmount.get())),
+              filterKey (s.resolveParameter (s.filterKey.get())),
+              filterVelocity (s.resolveParameter (s.filterVelocity.get())),
+              legato (s.resolveParameter (s.legato.get()))
+        {
+            for (int i = 0; i < numElementsInArray (osc); ++i)
+            {
+                auto& o = *s.oscParams[i];
+                osc[i] = { s.resolveParameter (o.tune.get()), s.resolveParameter (o.fineTune.get()),
+                           s.resolveParameter (o.level.get()), s.resolveParameter (o.pulseWidth.get()),
+                           s.resolveParameter (o.detune.get()), s.resolveParameter (o.spread.get()),
+                           s.resolveParameter (o.pan.get()) };
+            }
+
+            for (int i = 0; i < numElementsInArray (lfo); ++i)
+                lfo[i] = { s.resolveParameter (s.lfoParams[i]->rate.get()), s.resolveParameter (s.lfoParams[i]->depth.get()) };
+
+            for (int i = 0; i < numElementsInArray (modEnv); ++i)
+            {
+                auto& e = *s.modEnvParams[i];
+                modEnv[i] = { s.resolveParameter (e.modAttack.get()), s.resolveParameter (e.modDecay.get()),
+                              s.resolveParameter (e.modSustain.get()), s.resolveParameter (e.modRelease.get()) };
+            }
+        }
+
+        ResolvedParam ampAttack, ampDecay, ampSustain, ampRelease, ampVelocity;
+        ResolvedParam filterAttack, filterDecay, filterSustain, filterRelease, filterFreq,
+                      filterResonance, filterAmount, filterKey, filterVelocity;
+        ResolvedParam legato;
+
+        struct { ResolvedParam tune, fineTune, level, pulseWidth, detune, spread, pan; } osc[4];
+        struct { ResolvedParam rate, depth; } lfo[2];
+        struct { ResolvedParam modAttack, modDecay, modSustain, modRelease; } modEnv[2];
+    };
+
+    float paramValue (const ResolvedParam& resolved)
     {
+        auto param = resolved.param;
         jassert (param != nullptr);
         if (param == nullptr)
             return 0.0f;
 
-        auto smoothItr = smoothers.find (param.get());
-        if (smoothItr == smoothers.end())
+        if (! isPositiveAndBelow (resolved.index, (int) smoothers.size()))
             return param->getCurrentValue();
 
-        auto modItr = synth.modMatrix.find (param.get());
-        if (modItr == synth.modMatrix.end() || ! modItr->second.isModulated())
+        auto& smoother = smoothers[(size_t) resolved.index];
+
+        if (resolved.mod == nullptr || ! resolved.mod->isModulated())
         {
-            smoothItr->second.setValue (param->getCurrentNormalisedValue());
+            smoother.setValue (param->getCurrentNormalisedValue());
 
             if (snapAllValues)
-                smoothItr->second.snapToValue();
+                smoother.snapToValue();
 
-            return param->valueRange.convertFrom0to1 (smoothItr->second.getCurrentValue());
+            return param->valueRange.convertFrom0to1 (smoother.getCurrentValue());
         }
         else
         {
             float val = param->getCurrentNormalisedValue();
 
-            auto& mod = modItr->second;
+            auto& mod = *resolved.mod;
 
             for (int i = mod.firstModIndex; i < numElementsInArray (mod.depths) && i <= mod.lastModIndex; i++)
             {
@@ -718,18 +772,19 @@ private:
 
             val = jlimit (0.0f, 1.0f, val);
 
-            smoothItr->second.setValue (val);
+            smoother.setValue (val);
 
             if (snapAllValues)
-                smoothItr->second.snapToValue();
+                smoother.snapToValue();
 
-            return param->valueRange.convertFrom0to1 (smoothItr->second.getCurrentValue());
+            return param->valueRange.convertFrom0to1 (smoother.getCurrentValue());
         }
     }
 
     FourOscPlugin& synth;
+    const ResolvedParams params;
 
-    juce::AudioSampleBuffer renderBuffer {2, 512};
+    juce::AudioSampleBuffer renderBuffer;
     MultiVoiceOscillator oscillators[4];
     ExpEnvelope ampAdsr;
     LinEnvelope filterAdsr, modAdsr1, modAdsr2;
@@ -744,7 +799,8 @@ private:
 
     float currentModValue[FourOscPlugin::numModSources] = {0};
 
-    std::map<AutomatableParameter*, ValueSmoother<float>> smoothers;
+    // Indexed by ResolvedParam::index
+    std::vector<ValueSmoother<float>> smoothers;
 };
 
 //==============================================================================
@@ -1039,7 +1095,20 @@ FourOscPlugin::FourOscPlugin (PluginCreationInfo info)  : Plugin (info)
         e->attach();
 
     for (auto p : getAutomatableParameters())
-        smoothers[p] = {};
+    {
+        const auto index = (int) parameterIndexes.size();
+        parameterIndexes[p] = index;
+    }
+
+    smoothers.resize (parameterIndexes.size());
+
+    effectParams = { resolveParameter (distortion.get()), resolveParameter (reverbSize.get()),
+                     resolveParameter (reverbDamping.get()), resolveParameter (reverbWidth.get()),
+                     resolveParameter (reverbMix.get()), resolveParameter (delayFeedback.get()),
+                     resolveParameter (delayCrossfeed.get()), resolveParameter (delayMix.get()),
+                     resolveParameter (chorusSpeed.get()), resolveParameter (chorusDepth.get()),
+                     resolveParameter (chorusWidth.get()), resolveParameter (chorusMix.get()),
+                     resolveParameter (masterLevel.get()) };
 
     // Setup text functions
     setupTextFunctions();
@@ -1422,8 +1491,16 @@ void FourOscPlugin::initialise (const PlaybackInitialisationInfo& info)
     delay->reset();
     chorus->reset();
 
-    for (auto& itr : smoothers)
-        itr.second.reset (info.sampleRate, 0.01f);
+    for (auto& smoother : smoothers)
+        smoother.reset (info.sampleRate, 0.01f);
+
+    maxBlockSize = jmax (1, info.blockSizeSamples);
+
+    juce::ScopedLock sl (voicesLock);
+
+    for (auto v : voices)
+        if (auto fov = dynamic_cast<FourOscVoice*> (v))
+            fov->setMaxBlockSize (maxBlockSize);
 }
 
 void FourOscPlugin::deinitialise()
@@ -1505,8 +1582,8 @@ void FourOscPlugin::applyToBuffer (AudioSampleBuffer& buffer, MidiBuffer& midi)
     renderNextBlock (buffer, midi, 0, buffer.getNumSamples());
     applyEffects (buffer);
 
-    for (auto& itr : smoothers)
-        itr.second.process (buffer.getNumSamples());
+    for (auto& smoother : smoothers)
+        smoother.process (buffer.getNumSamples());
 }
 
 void FourOscPlugin::applyEffects (AudioSampleBuffer& buffer)
@@ -1516,7 +1593,7 @@ void FourOscPlugin::applyEffects (AudioSampleBuffer& buffer)
     // Apply Distortion
     if (distortionOnValue)
     {
-        float drive = paramValue (distortion);
+        float drive = paramValue (effectParams.distortion);
         float clip = 1.0f / (2.0f * drive);
         Distortion::distortion (buffer.getWritePointer (0), numSamples, drive, -clip, clip);
         Distortion::distortion (buffer.getWritePointer (1), numSamples, drive, -clip, clip);
@@ -1535,7 +1612,7 @@ void FourOscPlugin::applyEffects (AudioSampleBuffer& buffer)
         reverb.processStereo (buffer.getWritePointer (0), buffer.getWritePointer (1), numSamples);
 
     // Apply master level
-    buffer.applyGain (Decibels::decibelsToGain (paramValue (masterLevel)));
+    buffer.applyGain (Decibels::decibelsToGain (paramValue (effectParams.masterLevel)));
 }
 
 void FourOscPlugin::updateParams (AudioSampleBuffer& buffer)
@@ -1543,12 +1620,12 @@ void FourOscPlugin::updateParams (AudioSampleBuffer& buffer)
     ignoreUnused (buffer);
 
     // Reverb
-    AudioFadeCurve::CrossfadeLevels wetDry (paramValue (reverbMix));
+    AudioFadeCurve::CrossfadeLevels wetDry (paramValue (effectParams.reverbMix));
 
     Reverb::Parameters params;
-    params.roomSize = paramValue (reverbSize);
-    params.damping = paramValue (reverbDamping);
-    params.width = paramValue (reverbWidth);
+    params.roomSize = paramValue (effectParams.reverbSize);
+    params.damping = paramValue (effectParams.reverbDamping);
+    params.width = paramValue (effectParams.reverbWidth);
     params.wetLevel = wetDry.gain1;
     params.dryLevel = wetDry.gain2;
     params.freezeMode = 0;
@@ -1558,15 +1635,15 @@ void FourOscPlugin::updateParams (AudioSampleBuffer& buffer)
     // Delay
     float delayTime = (delayValue.get()) / (currentTempo / 60.0f);
     delay->setParams (delayTime,
-                      Decibels::decibelsToGain (paramValue (delayFeedback)),
-                      Decibels::decibelsToGain (paramValue (delayCrossfeed)),
-                      paramValue (delayMix));
+                      Decibels::decibelsToGain (paramValue (effectParams.delayFeedback)),
+                      Decibels::decibelsToGain (paramValue (effectParams.delayCrossfeed)),
+                      paramValue (effectParams.delayMix));
 
     // Chorus
-    chorus->setParams (paramValue (chorusSpeed),
-                       paramValue (chorusDepth),
-                       paramValue (chorusWidth),
-                       paramValue (chorusMix));
+    chorus->setParams (paramValue (effectParams.chorusSpeed),
+                       paramValue (effectParams.chorusDepth),
+                       paramValue (effectParams.chorusWidth),
+                       paramValue (effectParams.chorusMix));
 }
 
 //==============================================================================
@@ -1765,19 +1842,36 @@ void FourOscPlugin::clearModulation (ModSource src, AutomatableParameter::Ptr pa
     jassertfalse;
 }
 
-float FourOscPlugin::paramValue (AutomatableParameter::Ptr param)
+FourOscPlugin::ResolvedParam FourOscPlugin::resolveParameter (AutomatableParameter* param)
+{
+    ResolvedParam resolved;
+    resolved.param = param;
+
+    auto indexItr = parameterIndexes.find (param);
+    if (indexItr != parameterIndexes.end())
+        resolved.index = indexItr->second;
+
+    // Entries are only added to the mod matrix by the constructor, so this pointer stays valid
+    auto modItr = modMatrix.find (param);
+    if (modItr != modMatrix.end())
+        resolved.mod = &modItr->second;
+
+    return resolved;
+}
+
+float FourOscPlugin::paramValue (const ResolvedParam& resolved)
 {
+    auto param = resolved.param;
     jassert (param != nullptr);
     if (param == nullptr)
         return 0.0f;
 
-    auto smoothItr = smoothers.find (param.get());
-    if (smoothItr == smoothers.end())
+    if (! isPositiveAndBelow (resolved.index, (int) smoothers.size()))
         return param->getCurrentValue();
 
-    float val = param->getCurrentNormalisedValue();
-    smoothItr->second.setValue (val);
-    return param->valueRange.convertFrom0to1 (smoothItr->second.getCurrentValue());
+    auto& smoother = smoothers[(size_t) resolved.index];
+    smoother.setValue (param->getCurrentNormalisedValue());
+    return param->valueRange.convertFrom0to1 (smoother.getCurrentValue());
 }
 
 }
@@ -367,6 +367,23 @@ public:
     std::unordered_map<AutomatableParameter*, ModAssign> modMatrix;
     float controllerValues[128] = {0};
 
+    /** A parameter with its index in getAutomatableParameters() and its mod matrix entry
+        already looked up, so it can be read on the audio thread without searching any maps.
+        The global effect parameters have no mod matrix entry.
+    */
+    struct ResolvedParam
+    {
+        AutomatableParameter* param = nullptr;
+        ModAssign* mod = nullptr;
+        int index = -1;
+    };
+
+    /** Looks up one of our parameters. This searches, so call it once and keep the result. */
+    ResolvedParam resolveParameter (AutomatableParameter*);
+
+    /** The largest block size the voices should preallocate for. */
+    int getMaxBlockSize() const                         { return maxBlockSize; }
+
     float getLevel (int channel);
 
 private:
@@ -387,13 +404,26 @@ private:
     void applyToBuffer (juce::AudioSampleBuffer& buffer, juce::MidiBuffer& midi);
     void updateParams (juce::AudioSampleBuffer& buffer);
     void applyEffects (juce::AudioSampleBuffer& buffer);
-    float paramValue (AutomatableParameter::Ptr param);
+    float paramValue (const ResolvedParam&);
 
     TempoSequencePosition currentPos {edit.tempoSequence};
     juce::Reverb reverb;
     std::unique_ptr<FODelay> delay;
     std::unique_ptr<FOChorus> chorus;
-    std::unordered_map<AutomatableParameter*, ValueSmoother<float>> smoothers;
+    std::unordered_map<AutomatableParameter*, int> parameterIndexes;
+
+    // Indexed by ResolvedParam::index
+    std::vector<ValueSmoother<float>> smoothers;
+
+    struct EffectParams
+    {
+        ResolvedParam distortion, reverbSize, reverbDamping, reverbWidth, reverbMix,
+                      delayFeedback, delayCrossfeed, delayMix,
+                      chorusSpeed, chorusDepth, chorusWidth, chorusMix, masterLevel;
+    };
+
+    EffectParams effectParams;
+    int maxBlockSize = 512;
 
     bool flushingState = false;
     float currentTempo = 0.0f;
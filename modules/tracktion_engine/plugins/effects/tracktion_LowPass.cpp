@@ -47,8 +47,7 @@ void LowPassPlugin::updateFilters()
         IIRCoefficients c = nowLowPass ? IIRCoefficients::makeLowPass  (sampleRate, newFreq)
                                        : IIRCoefficients::makeHighPass (sampleRate, newFreq);
 
-        filter[0].setCoefficients (c);
-        filter[1].setCoefficients (c);
+        filter.setCoefficients (0, c);
     }
 }
 
@@ -56,11 +55,11 @@ void LowPassPlugin::initialise (const PlaybackInitialisationInfo& info)
 {
     sampleRate = info.sampleRate;
 
-    for (int i = 0; i < numElementsInArray (filter); ++i)
-        filter[i].reset();
+    filter.prepare (sampleRate, 2);
 
     currentFilterFreq = 0;
     updateFilters();
+    filter.skipSmoothing();
 }
 
 void LowPassPlugin::deinitialise()
@@ -77,8 +76,7 @@ void LowPassPlugin::applyToBuffer (const AudioRenderContext& fc)
 
         clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
 
-        for (int i = jmin (2, fc.destBuffer->getNumChannels()); --i >= 0;)
-            filter[i].processSamples (fc.destBuffer->getWritePointer (i, fc.bufferStartSample), fc.bufferNumSamples);
+        filter.process (*fc.destBuffer, fc.bufferStartSample, fc.bufferNumSamples);
 
         sanitiseValues (*fc.destBuffer, fc.bufferStartSample, fc.bufferNumSamples, 3.0f);
     }
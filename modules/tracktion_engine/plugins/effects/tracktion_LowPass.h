@@ -40,7 +40,7 @@ public:
     AutomatableParameter::Ptr frequency;
 
 private:
-    juce::IIRFilter filter[2];
+    BiquadCascade filter { 1 };
     float currentFilterFreq = 0;
     bool isCurrentlyLowPass = false;
 
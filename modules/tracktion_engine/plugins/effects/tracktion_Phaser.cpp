@@ -35,6 +35,23 @@ void PhaserPlugin::initialise (const PlaybackInitialisationInfo& info)
     const float delayMs = 100.0f;
     sweep = minSweep = (double_Pi * delayMs) / sampleRate;
     sweepFactor = 1.001f;
+
+    idleSuspender.reset (sampleRate);
+    idleSuspender.setTailLength (getTailLength());
+}
+
+double PhaserPlugin::getTailLength() const
+{
+    const double feedback = std::abs (feedbackGain.get());
+
+    if (feedback >= 1.0)
+        return std::numeric_limits<double>::infinity();
+
+    // Roughly how long it takes the feedback round the all-pass stages, which
+    // delay it by around a millisecond, to fall by 80dB
+    const double minTail = 0.01;
+    return feedback > 0.0 ? jmax (minTail, 0.001 * -80.0 / Decibels::gainToDecibels (feedback))
+                          : minTail;
 }
 
 void PhaserPlugin::deinitialise()
@@ -48,6 +65,17 @@ void PhaserPlugin::applyToBuffer (const AudioRenderContext& fc)
 
     SCOPED_REALTIME_CHECK
 
+    clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
+
+    idleSuspender.setTailLength (getTailLength());
+
+    switch (idleSuspender.getNextAction (*fc.destBuffer, 2, fc.bufferStartSample, fc.bufferNumSamples))
+    {
+        case IdleSuspender::Action::skip:           return;
+        case IdleSuspender::Action::wakeAndProcess: zeromem (filterVals, sizeof (filterVals)); break;
+        case IdleSuspender::Action::process:        break;
+    }
+
     const double range = pow (2.0, (double) depth);
     const double sweepUp = pow (range, rate / (sampleRate / 2));
     const double sweepDown = 1.0 / sweepUp;
@@ -58,8 +86,6 @@ void PhaserPlugin::applyToBuffer (const AudioRenderContext& fc)
     double swpFactor = sweepFactor > 1.0 ? sweepUp : sweepDown;
     double swp = sweep;
 
-    clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
-
     for (int chan = jmin (2, fc.destBuffer->getNumChannels()); --chan >= 0;)
     {
         float* b = fc.destBuffer->getWritePointer (chan, fc.bufferStartSample);
@@ -28,6 +28,7 @@ public:
     void deinitialise() override;
     int getNumOutputChannelsGivenInputs (int numInputChannels) override  { return juce::jmin (numInputChannels, 2); }
     void applyToBuffer (const AudioRenderContext&) override;
+    double getTailLength() const override;
     juce::String getSelectableDescription() override;
     void restorePluginStateFromValueTree (const juce::ValueTree&) override;
 
@@ -37,6 +38,7 @@ private:
     //==============================================================================
     double filterVals[2][8];
     double sweep, sweepFactor, minSweep;
+    IdleSuspender idleSuspender;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PhaserPlugin)
 };
@@ -17,93 +17,188 @@ struct PitchShiftPlugin::Pimpl
 
     Pimpl (PitchShiftPlugin& p) : owner (p)
     {
+        cleanupTimer.setCallback ([this]
+                                  {
+                                      deleteProcessor (retired.exchange (nullptr));
+
+                                      if (pending.load() == nullptr)
+                                          cleanupTimer.stopTimer();
+                                  });
     }
 
-    void initialise (double sr, float semitonesUp, TimeStretcher::Mode newMode, TimeStretcher::ElastiqueProOptions newOptions)
+    ~Pimpl()
     {
-        if (timestretcher == nullptr || mode != newMode || elastiqueOptions != newOptions)
-        {
-            mode = newMode;
-            elastiqueOptions = newOptions;
-            timestretcher.reset (new TimeStretcher());
-        }
+        deleteProcessor (pending.exchange (nullptr));
+        deleteProcessor (retired.exchange (nullptr));
+    }
 
-        if (! timestretcher->isInitialised())
+    //==============================================================================
+    /** A stretcher along with everything it needs to run, all allocated up front
+        so that none of it has to be created on the audio thread.
+    */
+    struct Processor
+    {
+        Processor (double sampleRate, TimeStretcher::Mode m, TimeStretcher::ElastiqueProOptions o,
+                   float semis, int minimumLatencySamples)
+            : mode (m), options (o), semitones (semis)
         {
-            timestretcher->initialise (sr, samplesPerBlock, 2, mode, elastiqueOptions, true);
-            jassert (timestretcher->isInitialised());
+            stretcher.initialise (sampleRate, samplesPerBlock, 2, mode, options, true);
+            jassert (stretcher.isInitialised());
+
+            if (stretcher.isInitialised())
+            {
+                stretcher.setSpeedAndPitch (1.0f, semitones);
+                maxFramesNeeded = stretcher.getMaxFramesNeeded();
+            }
+
+            // The output is delayed by at least as much as the stretcher needs, but may be
+            // padded out further so that swapping stretchers doesn't change the latency
+            latencySamples = jmax (maxFramesNeeded, minimumLatencySamples);
+
+            inBuffer.setSize (2, jmax (1, maxFramesNeeded));
+            outBuffer.setSize (2, samplesPerBlock);
+            inputFifo.setSize (2, maxFramesNeeded + 4 * samplesPerBlock);
+            outputFifo.setSize (2, latencySamples + 4 * samplesPerBlock);
+
+            outputFifo.writeSilence (latencySamples);
         }
 
-        if (timestretcher->isInitialised())
+        void process (AudioBuffer<float>& buffer, int startSample, int numSamples, float newSemitones)
         {
-            timestretcher->reset();
-            timestretcher->setSpeedAndPitch (1.0f, semitonesUp);
+            if (newSemitones != semitones)
+            {
+                semitones = newSemitones;
 
-            latencySamples = timestretcher->getMaxFramesNeeded();
+                if (! stretcher.setSpeedAndPitch (1.0f, semitones))
+                    jassertfalse;
+            }
+
+            inputFifo.write (buffer, startSample, numSamples);
+
+            for (int needed = stretcher.getFramesNeeded();
+                 inputFifo.getNumReady() >= needed && outputFifo.getFreeSpace() >= samplesPerBlock;
+                 needed = stretcher.getFramesNeeded())
+            {
+                if (needed > inBuffer.getNumSamples())
+                {
+                    jassertfalse;
+                    break;
+                }
+
+                inputFifo.read (inBuffer, 0, needed);
+                stretcher.processData (inBuffer.getArrayOfReadPointers(), needed, outBuffer.getArrayOfWritePointers());
+                outputFifo.write (outBuffer, 0, samplesPerBlock);
+            }
 
-            inputFifo.setSize (2, latencySamples + 2000);
-            outputFifo.setSize (2, latencySamples + 2000);
+            if (outputFifo.getNumReady() < numSamples)
+            {
+                jassertfalse;
+                buffer.clear (startSample, numSamples);
+            }
+            else
+            {
+                outputFifo.read (buffer, startSample, numSamples);
+            }
         }
 
-        inputFifo.reset();
-        outputFifo.reset();
+        TimeStretcher stretcher;
+        const TimeStretcher::Mode mode;
+        const TimeStretcher::ElastiqueProOptions options;
+        float semitones;
+        int maxFramesNeeded = 0, latencySamples = 0;
+
+        AudioBuffer<float> inBuffer, outBuffer;
+        AudioFifo inputFifo { 2, 1 }, outputFifo { 2, 1 };
 
-        outputFifo.writeSilence (latencySamples);
+        JUCE_DECLARE_NON_COPYABLE (Processor)
+    };
 
+    //==============================================================================
+    void initialise (double sr)
+    {
+        sampleRate = sr;
+        cleanupTimer.stopTimer();
+        deleteProcessor (pending.exchange (nullptr));
+        deleteProcessor (retired.exchange (nullptr));
+
+        active.reset (createProcessor (0));
+        latencySamples = active->latencySamples;
         latencySeconds = latencySamples / sr;
     }
 
-    void applyToBuffer (const AudioRenderContext& fc, float semis)
+    /** Called on the message thread when the mode or options change. The new stretcher
+        is handed over to the audio thread, which swaps it in at the start of its next block.
+    */
+    void prepareProcessor()
     {
-        SCOPED_REALTIME_CHECK
+        if (sampleRate <= 0.0)
+            return;
 
-        if (timestretcher->isInitialised())
-        {
-            auto newMode = (TimeStretcher::Mode) owner.mode.get();
-            auto newOptions = owner.elastiqueOptions.get();
+        auto newProcessor = createProcessor (latencySamples);
 
-            if (newMode != mode || newOptions != elastiqueOptions)
-                initialise (owner.sampleRate, semis, newMode, newOptions);
+        // If the new mode needs more time than the latency that's been reported, the
+        // playback graph has to be rebuilt so it can be compensated for
+        if (newProcessor->latencySamples > latencySamples)
+            owner.playbackRestartTimer.startTimer (50);
 
-            inputFifo.write (*fc.destBuffer, fc.bufferStartSample, fc.bufferNumSamples);
+        deleteProcessor (pending.exchange (newProcessor));
+        cleanupTimer.startTimer (100);
+    }
 
-            int needed = timestretcher->getFramesNeeded();
+    void applyToBuffer (const AudioRenderContext& fc, float semis)
+    {
+        SCOPED_REALTIME_CHECK
 
-            if (! timestretcher->setSpeedAndPitch (1.0f, semis))
-                jassertfalse;
+        swapInPendingProcessor();
 
-            while (inputFifo.getNumReady() >= needed && outputFifo.getFreeSpace() >= samplesPerBlock)
-            {
-                timestretcher->processData (inputFifo, needed, outputFifo);
-                needed = timestretcher->getFramesNeeded();
-            }
+        if (active == nullptr || ! active->stretcher.isInitialised())
+            return;
 
-            if (outputFifo.getNumReady() < fc.bufferNumSamples)
-            {
-                jassertfalse;
-                fc.destBuffer->clear (fc.bufferStartSample, fc.bufferNumSamples);
-            }
-            else
-            {
-                outputFifo.read (*fc.destBuffer, fc.bufferStartSample, fc.bufferNumSamples);
-            }
+        // Fed in small pieces so that the fifos don't need to grow with the host's block size
+        for (int start = 0; start < fc.bufferNumSamples; start += samplesPerBlock)
+            active->process (*fc.destBuffer, fc.bufferStartSample + start,
+                             jmin ((int) samplesPerBlock, fc.bufferNumSamples - start), semis);
 
-            if (fc.bufferForMidiMessages != nullptr)
-                fc.bufferForMidiMessages->addToNoteNumbers (roundToInt (semis));
-        }
+        if (fc.bufferForMidiMessages != nullptr)
+            fc.bufferForMidiMessages->addToNoteNumbers (roundToInt (semis));
     }
 
+    //==============================================================================
     PitchShiftPlugin& owner;
+    double sampleRate = 0.0;
 
-    std::unique_ptr<TimeStretcher> timestretcher;
-    TimeStretcher::Mode mode;
-    TimeStretcher::ElastiqueProOptions elastiqueOptions;
-
-    AudioFifo inputFifo { 2, 2000 }, outputFifo { 2, 2000 };
+    std::unique_ptr<Processor> active;
+    std::atomic<Processor*> pending { nullptr }, retired { nullptr };
+    LambdaTimer cleanupTimer;
 
     double latencySeconds = 0.0;
     int latencySamples = 0;
 
+    Processor* createProcessor (int minimumLatencySamples)
+    {
+        return new Processor (sampleRate, (TimeStretcher::Mode) owner.mode.get(), owner.elastiqueOptions.get(),
+                              owner.semitones->getCurrentValue(), minimumLatencySamples);
+    }
+
+    void swapInPendingProcessor() noexcept
+    {
+        // The old one is only handed back once the last has been collected, so
+        // nothing ever gets deleted on the audio thread
+        if (pending.load() == nullptr || retired.load() != nullptr)
+            return;
+
+        if (auto p = pending.exchange (nullptr))
+        {
+            retired = active.release();
+            active.reset (p);
+        }
+    }
+
+    static void deleteProcessor (Processor* p)
+    {
+        std::unique_ptr<Processor> (p).reset();
+    }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Pimpl)
 };
 
@@ -127,6 +222,12 @@ PitchShiftPlugin::PitchShiftPlugin (PluginCreationInfo info) : Plugin (info)
     elastiqueOptions.referTo (state, IDs::elastiqueOptions, um);
 
     semitones->attachToCurrentValue (semitonesValue);
+
+    playbackRestartTimer.setCallback ([this]
+                                      {
+                                          edit.restartPlayback();
+                                          playbackRestartTimer.stopTimer();
+                                      });
 }
 
 PitchShiftPlugin::PitchShiftPlugin (Edit& ed, const juce::ValueTree& v)
@@ -153,8 +254,7 @@ const char* PitchShiftPlugin::xmlTypeName = "pitchShifter";
 //==============================================================================
 void PitchShiftPlugin::initialise (const PlaybackInitialisationInfo& info)
 {
-    pimpl->initialise (info.sampleRate, semitones->getCurrentValue(),
-                       (TimeStretcher::Mode) mode.get(), elastiqueOptions.get());
+    pimpl->initialise (info.sampleRate);
 }
 
 void PitchShiftPlugin::deinitialise()
@@ -189,4 +289,16 @@ void PitchShiftPlugin::restorePluginStateFromValueTree (const juce::ValueTree& v
         p->updateFromAttachedValue();
 }
 
+void PitchShiftPlugin::valueTreePropertyChanged (ValueTree& v, const juce::Identifier& id)
+{
+    if (v == state && (id == IDs::mode || id == IDs::elastiqueOptions))
+    {
+        mode.forceUpdateOfCachedValue();
+        elastiqueOptions.forceUpdateOfCachedValue();
+        pimpl->prepareProcessor();
+    }
+
+    Plugin::valueTreePropertyChanged (v, id);
+}
+
 }
@@ -47,6 +47,9 @@ public:
 private:
     struct Pimpl;
     std::unique_ptr<Pimpl> pimpl;
+    LambdaTimer playbackRestartTimer;
+
+    void valueTreePropertyChanged (juce::ValueTree&, const juce::Identifier&) override;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PitchShiftPlugin)
 };
@@ -75,33 +75,39 @@ const char* ReverbPlugin::xmlTypeName = "reverb";
 
 void ReverbPlugin::initialise (const PlaybackInitialisationInfo& info)
 {
-    outputSilent = true;
-    reverb.setSampleRate (info.sampleRate);
+    idleSuspender.reset (info.sampleRate);
+    idleSuspender.setTailLength (getTailLength());
+
+    // setSampleRate() allocates the comb and all-pass buffers, so this is done here
+    // rather than on the audio thread
+    if (reverb == nullptr)
+        reverb = std::make_unique<Reverb>();
+
+    reverb->setSampleRate (info.sampleRate);
+    reverb->setParameters (currentParams);
+    reverb->reset();
 }
 
 void ReverbPlugin::deinitialise()
 {
+    reverb = nullptr;
 }
 
 void ReverbPlugin::reset()
 {
-    reverb.reset();
-}
-
-static bool isNotSilent (float v) noexcept
-{
-    const float zeroThresh = 1.0f / 8000.0f;
-    return v < -zeroThresh || v > zeroThresh;
+    if (reverb != nullptr)
+        reverb->reset();
 }
 
-static bool isSilent (const float* data, int num) noexcept
+double ReverbPlugin::getTailLength() const
 {
-    if (isNotSilent (data[0]) || isNotSilent (data[num / 2]))
-        return false;
+    if (modeParam->getCurrentValue() >= freezemode)
+        return std::numeric_limits<double>::infinity();
 
-    Range<float> range (FloatVectorOperations::findMinAndMax (data, num));
-
-    return ! (isNotSilent (range.getStart()) || isNotSilent (range.getEnd()));
+    // The longest comb filter is about 37ms and each trip round it is scaled by the
+    // feedback, which is set from the room size, so this is how long it takes to fall by 80dB
+    const double feedback = roomSizeParam->getCurrentValue() * 0.28 + 0.7;
+    return 0.037 * -80.0 / Decibels::gainToDecibels (feedback);
 }
 
 void ReverbPlugin::applyToBuffer (const AudioRenderContext& fc)
@@ -118,34 +124,36 @@ void ReverbPlugin::applyToBuffer (const AudioRenderContext& fc)
         params.width      = widthParam->getCurrentValue();
         params.freezeMode = modeParam->getCurrentValue();
 
-        if (memcmp (&params, &reverb.getParameters(), sizeof (params)) != 0)
-            reverb.setParameters (params);
+        const bool paramsChanged = memcmp (&params, &currentParams, sizeof (params)) != 0;
+
+        if (paramsChanged)
+        {
+            currentParams = params;
+            idleSuspender.setTailLength (getTailLength());
+        }
 
         const int num = fc.bufferNumSamples;
-        float* const left = fc.destBuffer->getWritePointer (0, fc.bufferStartSample);
+        clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
 
-        if (fc.destBuffer->getNumChannels() >= 2)
-        {
-            clearChannels (*fc.destBuffer, 2, -1, fc.bufferStartSample, fc.bufferNumSamples);
+        const auto action = idleSuspender.getNextAction (*fc.destBuffer, 2, fc.bufferStartSample, num);
 
-            float* const right = fc.destBuffer->getWritePointer (1, fc.bufferStartSample);
+        if (action == IdleSuspender::Action::skip)
+            return;
 
-            if (outputSilent && isSilent (left, num) && isSilent (right, num))
-                return;
+        jassert (reverb != nullptr);
 
-            reverb.processStereo (left, right, num);
+        if (paramsChanged || action == IdleSuspender::Action::wakeAndProcess)
+            reverb->setParameters (params);
 
-            outputSilent = isSilent (left, num) && isSilent (right, num);
-        }
-        else
-        {
-            if (outputSilent && isSilent (left, num))
-                return;
+        if (action == IdleSuspender::Action::wakeAndProcess)
+            reverb->reset();
 
-            reverb.processMono (left, num);
+        float* const left = fc.destBuffer->getWritePointer (0, fc.bufferStartSample);
 
-            outputSilent = isSilent (left, num);
-        }
+        if (fc.destBuffer->getNumChannels() >= 2)
+            reverb->processStereo (left, fc.destBuffer->getWritePointer (1, fc.bufferStartSample), num);
+        else
+            reverb->processMono (left, num);
 
         zeroDenormalisedValuesIfNeeded (*fc.destBuffer);
     }
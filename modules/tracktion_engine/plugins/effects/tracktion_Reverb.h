@@ -28,6 +28,7 @@ public:
     void initialise (const PlaybackInitialisationInfo&) override;
     void deinitialise() override;
     void reset() override;
+    double getTailLength() const override;
     int getNumOutputChannelsGivenInputs (int numInputChannels) override { return juce::jmin (numInputChannels, 2); }
     void applyToBuffer (const AudioRenderContext&) override;
     juce::String getSelectableDescription() override    { return TRANS("Reverb Plugin"); }
@@ -59,8 +60,9 @@ public:
                               dryParam, widthParam, modeParam;
 
 private:
-    bool outputSilent = true;
-    juce::Reverb reverb;
+    std::unique_ptr<juce::Reverb> reverb;
+    juce::Reverb::Parameters currentParams;
+    IdleSuspender idleSuspender;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ReverbPlugin)
 };
@@ -15,37 +15,88 @@ namespace tracktion_engine
 static constexpr int minimumSamplesToPlayWhenStopping = 8;
 static constexpr int maximumSimultaneousNotes = 32;
 
+// the number of notes of each streamed sound that can play past the preloaded section at once
+static constexpr int maximumStreamsPerSound = 8;
+static constexpr int streamBufferSize = 16384;
+static constexpr int streamChunkSize = 8192;
+
+//==============================================================================
+namespace
+{
+    /** Keeps the SampleData objects that are in use so that sounds using the same
+        excerpt of the same file can share them.
+        The registry holds a reference to each one, and only drops it under the lock
+        once nothing else is using it. That way an object is never handed out while
+        it's being deleted, and a note finishing on the audio thread never deletes one.
+    */
+    struct SampleDataRegistry
+    {
+        static SampleDataRegistry& getInstance()
+        {
+            static SampleDataRegistry registry;
+            return registry;
+        }
+
+        /** Releases any data that only the registry is holding on to. */
+        void purgeUnused()
+        {
+            const ScopedLock sl (lock);
+
+            for (int i = items.size(); --i >= 0;)
+                if (items.getUnchecked (i)->getReferenceCount() == 1)
+                    items.remove (i);
+        }
+
+        CriticalSection lock;
+        ReferenceCountedArray<SamplerPlugin::SamplerSound::SampleData> items;
+    };
+}
+
 
 struct SamplerPlugin::SampledNote   : public ReferenceCountedObject
 {
 public:
-    SampledNote (int midiNote, int keyNote,
+    SampledNote (int midiNote,
                  float velocity,
-                 const AudioFile& file,
                  double sampleRate,
                  int sampleDelayFromBufferStart,
-                 const juce::AudioBuffer<float>& data,
-                 int lengthInSamples,
-                 float gainDb,
-                 float pan,
-                 bool openEnded_)
+                 SamplerSound& s)
        : note (midiNote),
          offset (-sampleDelayFromBufferStart),
-         audioData (data),
-         openEnded (openEnded_)
+         sound (s),
+         sampleData (s.sampleData),
+         openEnded (s.openEnded)
     {
         resampler[0].reset();
         resampler[1].reset();
 
-        const float volumeSliderPos = decibelsToVolumeFaderPosition (gainDb - (20.0f * (1.0f - velocity)));
-        getGainsFromVolumeFaderPositionAndPan (volumeSliderPos, pan, getDefaultPanLaw(), gains[0], gains[1]);
+        const float volumeSliderPos = decibelsToVolumeFaderPosition (s.gainDb - (20.0f * (1.0f - velocity)));
+        getGainsFromVolumeFaderPositionAndPan (volumeSliderPos, s.pan, getDefaultPanLaw(), gains[0], gains[1]);
 
         const double hz = MidiMessage::getMidiNoteInHertz (midiNote);
-        playbackRatio = hz / MidiMessage::getMidiNoteInHertz (keyNote);
-        playbackRatio *= file.getSampleRate() / sampleRate;
+        playbackRatio = hz / MidiMessage::getMidiNoteInHertz (s.keyNote);
+        playbackRatio *= s.audioFile.getSampleRate() / sampleRate;
+
+        int lengthInSamples = s.fileLengthSamples;
+
+        if (! sampleData->isComplete)
+        {
+            stream = s.claimStream();
+
+            // if all the streams are busy we can only play the part that's in memory
+            if (stream == nullptr)
+                lengthInSamples = sampleData->numSamples;
+        }
+
         samplesLeftToPlay = playbackRatio > 0 ? (1 + (int) (lengthInSamples / playbackRatio)) : 0;
     }
 
+    ~SampledNote()
+    {
+        if (stream != nullptr)
+            sound.releaseStream (*stream);
+    }
+
     void addNextBlock (juce::AudioBuffer<float>& outBuffer, int startSamp, int numSamples)
     {
         jassert (! isFinished);
@@ -62,13 +113,15 @@ public:
 
         if (numSamps > 0)
         {
+            int sourceStart = 0;
+            auto& source = getSourceData (roundToInt (numSamps * playbackRatio) + 8, sourceStart);
             int numUsed = 0;
 
             for (int i = jmin (2, outBuffer.getNumChannels()); --i >= 0;)
             {
                 numUsed = resampler[i]
                             .processAdding (playbackRatio,
-                                            audioData.getReadPointer (jmin (i, audioData.getNumChannels() - 1), offset),
+                                            source.getReadPointer (jmin (i, source.getNumChannels() - 1), sourceStart),
                                             outBuffer.getWritePointer (i, startSamp),
                                             numSamps,
                                             gains[i]);
@@ -77,7 +130,7 @@ public:
             offset += numUsed;
             samplesLeftToPlay -= numSamps;
 
-            jassert (offset <= audioData.getNumSamples());
+            jassert (stream != nullptr || offset <= sampleData->buffer.getNumSamples());
         }
 
         if (numSamples > numSamps && startFade > 0.0f)
@@ -97,12 +150,15 @@ public:
             }
 
             const int numSampsNeeded = 2 + roundToInt ((numSamps + 2) * playbackRatio);
-            AudioScratchBuffer scratch (audioData.getNumChannels(), numSampsNeeded + 8);
+            AudioScratchBuffer scratch (sampleData->buffer.getNumChannels(), numSampsNeeded + 8);
 
-            if (offset + numSampsNeeded < audioData.getNumSamples())
+            int sourceStart = 0;
+            auto& source = getSourceData (numSampsNeeded, sourceStart);
+
+            if (sourceStart + numSampsNeeded <= source.getNumSamples())
             {
                 for (int i = scratch.buffer.getNumChannels(); --i >= 0;)
-                    scratch.buffer.copyFrom (i, 0, audioData, i, offset, numSampsNeeded);
+                    scratch.buffer.copyFrom (i, 0, source, i, sourceStart, numSampsNeeded);
             }
             else
             {
@@ -135,12 +191,58 @@ public:
     int offset, samplesLeftToPlay = 0;
     float gains[2];
     double playbackRatio = 1.0;
-    const juce::AudioBuffer<float>& audioData;
+    SamplerSound& sound;
+    const SamplerSound::SampleData::Ptr sampleData;
+    SamplerSound::Stream* stream = nullptr;
     float lastVals[4] = { 0, 0, 0, 0 };
     float startFade = 1.0f;
     bool openEnded, isFinished = false;
 
 private:
+    /** Returns a buffer holding the next numNeeded samples, starting at sourceStart.
+        While the note is inside the preloaded section this is just the sample data,
+        after that it's the note's stream buffer, filled from the cache.
+    */
+    const juce::AudioBuffer<float>& getSourceData (int numNeeded, int& sourceStart)
+    {
+        sourceStart = offset;
+
+        if (stream == nullptr || offset + numNeeded <= sampleData->numSamples)
+            return sampleData->buffer;
+
+        auto& dest = stream->buffer;
+
+        if (dest.getNumSamples() < numNeeded)
+            dest.setSize (dest.getNumChannels(), numNeeded, false, false, true);
+
+        const int numFromMemory = jlimit (0, numNeeded, sampleData->numSamples - offset);
+
+        if (numFromMemory > 0)
+            for (int i = dest.getNumChannels(); --i >= 0;)
+                dest.copyFrom (i, 0, sampleData->buffer, i, offset, numFromMemory);
+
+        auto& reader = *stream->reader;
+        jassert (reader.isReadingFromCache());
+        auto destChannels = AudioChannelSet::canonicalChannelSet (dest.getNumChannels());
+        int pos = numFromMemory;
+
+        reader.setReadPosition (sound.fileStartSample + offset + pos);
+
+        while (pos < numNeeded)
+        {
+            const int numThisTime = jmin (streamChunkSize, numNeeded - pos);
+
+            // never wait for the disk here, until the cache has mapped this part of the file the note is silent
+            if (! reader.readSamples (numThisTime, dest, destChannels, pos, AudioChannelSet::stereo(), 0))
+                dest.clear (pos, numThisTime);
+
+            pos += numThisTime;
+        }
+
+        sourceStart = 0;
+        return dest;
+    }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SampledNote)
 };
 
@@ -153,6 +255,9 @@ SamplerPlugin::SamplerPlugin (PluginCreationInfo info)  : Plugin (info)
 SamplerPlugin::~SamplerPlugin()
 {
     notifyListenersOfDeletion();
+
+    soundList.clear();
+    SampleDataRegistry::getInstance().purgeUnused();
 }
 
 const char* SamplerPlugin::xmlTypeName = "sampler";
@@ -192,22 +297,6 @@ void SamplerPlugin::handleAsyncUpdate()
         }
     }
 
-    for (auto newSound : newSounds)
-    {
-        for (auto s : soundList)
-        {
-            if (s->source == newSound->source
-                && s->startTime == newSound->startTime
-                && s->length == newSound->length)
-            {
-                newSound->audioFile = s->audioFile;
-                newSound->fileStartSample = s->fileStartSample;
-                newSound->fileLengthSamples = s->fileLengthSamples;
-                newSound->audioData = s->audioData;
-            }
-        }
-    }
-
     {
         const ScopedLock sl (lock);
         allNotesOff();
@@ -217,6 +306,7 @@ void SamplerPlugin::handleAsyncUpdate()
     }
 
     newSounds.clear();
+    SampleDataRegistry::getInstance().purgeUnused();
     changed();
 }
 
@@ -252,21 +342,11 @@ void SamplerPlugin::playNotes (const BigInteger& keysDown)
                 {
                     if (ss->minNote <= note
                          && ss->maxNote >= note
-                         && ss->audioData.getNumSamples() > 0
+                         && ss->hasAudio()
                          && (! ss->audioFile.isNull())
                          && playingNotes.size() < maximumSimultaneousNotes)
                     {
-                        playingNotes.add (new SampledNote (note,
-                                                           ss->keyNote,
-                                                           0.75f,
-                                                           ss->audioFile,
-                                                           sampleRate,
-                                                           0,
-                                                           ss->audioData,
-                                                           ss->fileLengthSamples,
-                                                           ss->gainDb,
-                                                           ss->pan,
-                                                           ss->openEnded));
+                        playingNotes.add (new SampledNote (note, 0.75f, sampleRate, 0, *ss));
                     }
                 }
             }
@@ -322,22 +402,13 @@ void SamplerPlugin::applyToBuffer (const AudioRenderContext& fc)
                     {
                         if (ss->minNote <= note
                             && ss->maxNote >= note
-                            && ss->audioData.getNumSamples() > 0
+                            && ss->hasAudio()
                             && playingNotes.size() < maximumSimultaneousNotes)
                         {
                             highlightedNotes.setBit (note);
 
-                            playingNotes.add (new SampledNote (note,
-                                                               ss->keyNote,
-                                                               m.getVelocity() / 127.0f,
-                                                               ss->audioFile,
-                                                               sampleRate,
-                                                               noteTimeSample,
-                                                               ss->audioData,
-                                                               ss->fileLengthSamples,
-                                                               ss->gainDb,
-                                                               ss->pan,
-                                                               ss->openEnded));
+                            playingNotes.add (new SampledNote (note, m.getVelocity() / 127.0f,
+                                                               sampleRate, noteTimeSample, *ss));
                         }
                     }
                 }
@@ -588,6 +659,9 @@ void SamplerPlugin::sourceMediaChanged()
 {
     const ScopedLock sl (lock);
 
+    // refreshing the sounds replaces their sample data and streams, so the notes using them have to go
+    allNotesOff();
+
     for (auto s : soundList)
         s->refreshFile();
 }
@@ -651,60 +725,165 @@ void SamplerPlugin::SamplerSound::setExcerpt (double startTime_, double length_)
         fileStartSample = roundToInt (startTime * audioFile.getSampleRate());
         fileLengthSamples = roundToInt (length * audioFile.getSampleRate());
 
-        if (auto reader = owner.engine.getAudioFileManager().cache.createReader (audioFile))
-        {
-            audioData.setSize (audioFile.getNumChannels(), fileLengthSamples + 32);
-            audioData.clear();
+        loadSampleData();
+        createStreams();
+    }
+    else
+    {
+        audioFile = AudioFile (owner.edit.engine);
+        sampleData = nullptr;
+        streams.clear();
+    }
+
+    // this sound may have let go of data that nothing else is using
+    SampleDataRegistry::getInstance().purgeUnused();
+}
+
+void SamplerPlugin::SamplerSound::refreshFile()
+{
+    audioFile = AudioFile (owner.edit.engine);
+    setExcerpt (startTime, length);
+}
 
-            auto audioDataChannelSet = AudioChannelSet::canonicalChannelSet (audioFile.getNumChannels());
-            auto channelsToUse = AudioChannelSet::stereo();
+bool SamplerPlugin::SamplerSound::hasAudio() const noexcept
+{
+    return sampleData != nullptr && sampleData->numSamples > 0;
+}
 
-            int total = fileLengthSamples;
-            int offset = 0;
+//==============================================================================
+void SamplerPlugin::SamplerSound::loadSampleData()
+{
+    CRASH_TRACER
+    auto reader = owner.engine.getAudioFileManager().cache.createReader (audioFile);
 
-            while (total > 0)
-            {
-                const int numThisTime = jmin (8192, total);
-                reader->setReadPosition (fileStartSample + offset);
+    const double preloadSeconds = owner.engine.getEngineBehaviour().getSamplerPreloadSeconds();
+    int numToLoad = fileLengthSamples;
 
-                if (! reader->readSamples (numThisTime, audioData, audioDataChannelSet, offset, channelsToUse, 2000))
-                {
-                    jassertfalse;
-                    break;
-                }
+    // the preloaded part needs to be long enough to cover the time it takes the cache to load the rest.
+    // Files the cache can't map would have to be streamed through a reader that might not have
+    // buffered the data yet, so they're always loaded completely.
+    if (preloadSeconds > 0 && reader != nullptr && reader->isReadingFromCache())
+        numToLoad = jmin (fileLengthSamples, jmax (streamBufferSize, roundToInt (preloadSeconds * audioFile.getSampleRate())));
+
+    auto file = audioFile.getFile();
+    auto key = file.getFullPathName()
+                + ":" + String (file.getLastModificationTime().toMilliseconds())
+                + ":" + String (fileStartSample)
+                + ":" + String (fileLengthSamples)
+                + ":" + String (numToLoad);
+
+    auto& registry = SampleDataRegistry::getInstance();
+
+    {
+        const ScopedLock sl (registry.lock);
 
-                offset += numThisTime;
-                total -= numThisTime;
+        for (auto d : registry.items)
+        {
+            if (d->key == key)
+            {
+                sampleData = d;
+                return;
             }
         }
-        else
+    }
+
+    SampleData::Ptr data (new SampleData());
+    sampleData = data;
+    data->key = key;
+    data->isComplete = numToLoad >= fileLengthSamples;
+
+    if (reader == nullptr)
+    {
+        data->buffer.clear();
+        return;
+    }
+
+    data->buffer.setSize (audioFile.getNumChannels(), numToLoad + 32);
+    data->buffer.clear();
+
+    auto audioDataChannelSet = AudioChannelSet::canonicalChannelSet (audioFile.getNumChannels());
+    auto channelsToUse = AudioChannelSet::stereo();
+
+    // if the rest is going to be streamed, the padding at the end can hold real audio
+    int total = data->isComplete ? numToLoad : numToLoad + 32;
+    int offset = 0;
+
+    while (total > 0)
+    {
+        const int numThisTime = jmin (8192, total);
+        reader->setReadPosition (fileStartSample + offset);
+
+        if (! reader->readSamples (numThisTime, data->buffer, audioDataChannelSet, offset, channelsToUse, 2000))
         {
-            audioData.clear();
+            jassertfalse;
+            break;
         }
 
-        // add a quick fade-in if needed..
-        int fadeLen = 0;
-        for (int i = audioData.getNumChannels(); --i >= 0;)
-        {
-            const float* d = audioData.getReadPointer (i);
+        offset += numThisTime;
+        total -= numThisTime;
+    }
 
-            if (std::abs (*d) > 0.01f)
-                fadeLen = 30;
-        }
+    data->numSamples = numToLoad;
+
+    // add a quick fade-in if needed..
+    int fadeLen = 0;
+    for (int i = data->buffer.getNumChannels(); --i >= 0;)
+    {
+        const float* d = data->buffer.getReadPointer (i);
 
-        if (fadeLen > 0)
-            AudioFadeCurve::applyCrossfadeSection (audioData, 0, fadeLen, AudioFadeCurve::concave, 0.0f, 1.0f);
+        if (std::abs (*d) > 0.01f)
+            fadeLen = 30;
     }
-    else
+
+    if (fadeLen > 0)
+        AudioFadeCurve::applyCrossfadeSection (data->buffer, 0, fadeLen, AudioFadeCurve::concave, 0.0f, 1.0f);
+
     {
-        audioFile = AudioFile (owner.edit.engine);
+        const ScopedLock sl (registry.lock);
+        registry.items.add (data);
     }
 }
 
-void SamplerPlugin::SamplerSound::refreshFile()
+void SamplerPlugin::SamplerSound::createStreams()
 {
-    audioFile = AudioFile (owner.edit.engine);
-    setExcerpt (startTime, length);
+    streams.clear();
+
+    if (sampleData == nullptr || sampleData->isComplete)
+        return;
+
+    for (int i = 0; i < maximumStreamsPerSound; ++i)
+    {
+        if (auto reader = owner.engine.getAudioFileManager().cache.createReader (audioFile))
+        {
+            auto s = streams.add (new Stream());
+            s->reader = reader;
+            s->buffer.setSize (sampleData->buffer.getNumChannels(), streamBufferSize);
+            releaseStream (*s);
+        }
+    }
+}
+
+SamplerPlugin::SamplerSound::Stream* SamplerPlugin::SamplerSound::claimStream()
+{
+    for (auto s : streams)
+    {
+        if (! s->isInUse)
+        {
+            s->isInUse = true;
+            return s;
+        }
+    }
+
+    return nullptr;
+}
+
+void SamplerPlugin::SamplerSound::releaseStream (Stream& s)
+{
+    s.isInUse = false;
+
+    // idle streams wait at the end of the preloaded section so the cache keeps
+    // that part of the file ready for the next note that needs it
+    s.reader->setReadPosition (fileStartSample + sampleData->numSamples);
 }
 
 }
@@ -83,6 +83,41 @@ public:
         void setExcerpt (double startTime, double length);
         void refreshFile();
 
+        /** Returns true if there's some audio loaded that can be played. */
+        bool hasAudio() const noexcept;
+
+        /** The part of a sound's excerpt that's held in memory.
+            Sounds that use the same file and excerpt share one of these.
+            If the excerpt is longer than EngineBehaviour::getSamplerPreloadSeconds()
+            only its start is loaded and the rest is streamed from the AudioFileCache.
+            Playing notes keep a reference to the data they're reading.
+        */
+        struct SampleData  : public juce::ReferenceCountedObject
+        {
+            using Ptr = juce::ReferenceCountedObjectPtr<SampleData>;
+
+            juce::String key;
+            juce::AudioBuffer<float> buffer { 2, 64 };
+            int numSamples = 0;         /**< The number of samples of the excerpt in the buffer. */
+            bool isComplete = true;     /**< False if the rest of the excerpt needs to be streamed. */
+        };
+
+        /** A cache reader and buffer a note can use to stream the part of the
+            excerpt that isn't preloaded.
+        */
+        struct Stream
+        {
+            AudioFileCache::Reader::Ptr reader;
+            juce::AudioBuffer<float> buffer;
+            bool isInUse = false;
+        };
+
+        /** Returns a free stream or nullptr if they're all in use. Call with the plugin's lock held. */
+        Stream* claimStream();
+
+        /** Returns a stream to the pool. Call with the plugin's lock held. */
+        void releaseStream (Stream&);
+
         SamplerPlugin& owner;
         juce::String source;
         juce::String name;
@@ -92,9 +127,13 @@ public:
         float gainDb = 0, pan = 0;
         double startTime = 0, length = 0;
         AudioFile audioFile;
-        juce::AudioBuffer<float> audioData { 2, 64 };
+        SampleData::Ptr sampleData;
+        juce::OwnedArray<Stream> streams;
 
     private:
+        void loadSampleData();
+        void createStreams();
+
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SamplerSound)
     };
 
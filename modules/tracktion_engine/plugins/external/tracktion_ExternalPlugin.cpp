@@ -473,7 +473,8 @@ ExternalPlugin::ExternalPlugin (PluginCreationInfo info)  : Plugin (info)
     desc.manufacturerName = state[IDs::manufacturer];
     identiferString = desc.createIdentifierString();
 
-    initialiseFully();
+    if (! edit.deferPluginInitialisation (*this))
+        initialiseFully();
 }
 
 ValueTree ExternalPlugin::create (Engine& e, const PluginDescription& desc)
@@ -499,10 +500,19 @@ void ExternalPlugin::initialiseFully()
     if (! fullyInitialised)
     {
         CRASH_TRACER_PLUGIN (getDebugName());
+        const EditLoadProfiler::ScopedEvent event (edit.getLoadProfiler(), EditLoadProfiler::instanceCategory,
+                                                   [this] (juce::String& name, juce::String& detail)
+                                                   {
+                                                       name = getName();
+                                                       detail = "initialiseFully " + itemID.toString();
+                                                   });
         fullyInitialised = true;
 
         doFullInitialisation();
-        restorePluginStateFromValueTree (state);
+
+        if (! instantiatedInBackground.exchange (false))
+            restorePluginStateFromValueTree (state);
+
         buildParameterList();
         restoreChannelLayout (*this);
     }
@@ -748,23 +758,79 @@ void ExternalPlugin::doFullInitialisation()
             });
 
             if (pluginInstance != nullptr)
-            {
-               #if JUCE_PLUGINHOST_VST
-                if (auto xml = juce::VSTPluginFormat::getVSTXML (pluginInstance.get()))
-                    vstXML.reset (VSTXML::createFor (*xml));
-
-                juce::VSTPluginFormat::setExtraFunctions (pluginInstance.get(), new ExtraVSTCallbacks (edit));
-               #endif
-
-                pluginInstance->setPlayHead (playhead.get());
-                supportsMPE = pluginInstance->supportsMPE();
-            }
+                initialiseNewInstance();
             else
-            {
                 TRACKTION_LOG_ERROR (error);
-            }
         }
+        else if (instantiatedInBackground && pluginInstance != nullptr)
+        {
+            initialiseNewInstance();
+        }
+    }
+}
+
+void ExternalPlugin::initialiseNewInstance()
+{
+   #if JUCE_PLUGINHOST_VST
+    if (auto xml = juce::VSTPluginFormat::getVSTXML (pluginInstance.get()))
+        vstXML.reset (VSTXML::createFor (*xml));
+
+    juce::VSTPluginFormat::setExtraFunctions (pluginInstance.get(), new ExtraVSTCallbacks (edit));
+   #endif
+
+    pluginInstance->setPlayHead (playhead.get());
+    supportsMPE = pluginInstance->supportsMPE();
+}
+
+bool ExternalPlugin::canInstantiateOnBackgroundThread() const
+{
+    if (fullyInitialised || pluginInstance != nullptr || ! processing || ! edit.shouldLoadPlugins())
+        return false;
+
+    if (auto foundDesc = findMatchingPlugin())
+        return engine.getEngineBehaviour().canInstantiatePluginOffMessageThread (*foundDesc);
+
+    return false;
+}
+
+void ExternalPlugin::instantiateOnBackgroundThread()
+{
+    jassert (! fullyInitialised);
+
+    auto foundDesc = findMatchingPlugin();
+
+    if (foundDesc == nullptr || pluginInstance != nullptr || isDisabled())
+        return;
+
+    CRASH_TRACER_PLUGIN (getDebugName());
+    const EditLoadProfiler::ScopedEvent event (edit.getLoadProfiler(), EditLoadProfiler::instanceCategory,
+                                               [this] (juce::String& name, juce::String& detail)
+                                               {
+                                                   name = getName();
+                                                   detail = "instantiateOnBackgroundThread " + itemID.toString();
+                                               });
+    auto error = createPluginInstance (*foundDesc);
+
+    if (pluginInstance == nullptr)
+    {
+        // initialiseFully() will have another go on the loading thread
+        TRACKTION_LOG_ERROR (error);
+        return;
     }
+
+    // Unlike restorePluginStateFromValueTree(), this mustn't write anything back to the state
+    MemoryBlock chunk;
+    getStateChunkFromTree (state, chunk);
+
+    if (chunk.getSize() > 0)
+    {
+        if (getNumPrograms() > 1)
+            pluginInstance->setCurrentProgram (jlimit (0, getNumPrograms() - 1, (int) state.getProperty (IDs::programNum)));
+
+        pluginInstance->setStateInformation (chunk.getData(), (int) chunk.getSize());
+    }
+
+    instantiatedInBackground = true;
 }
 
 //==============================================================================
@@ -850,7 +916,7 @@ void ExternalPlugin::flushBusesLayoutToValueTree()
     }
 }
 
-void ExternalPlugin::restorePluginStateFromValueTree (const juce::ValueTree& v)
+void ExternalPlugin::getStateChunkFromTree (const juce::ValueTree& v, MemoryBlock& chunk)
 {
     String s;
 
@@ -871,18 +937,28 @@ void ExternalPlugin::restorePluginStateFromValueTree (const juce::ValueTree& v)
         }
     }
 
-    if (pluginInstance != nullptr && s.isNotEmpty())
+    chunk.reset();
+
+    if (s.isNotEmpty())
+        chunk.fromBase64Encoding (s);
+}
+
+void ExternalPlugin::restorePluginStateFromValueTree (const juce::ValueTree& v)
+{
+    if (pluginInstance == nullptr)
+        return;
+
+    MemoryBlock chunk;
+    getStateChunkFromTree (v, chunk);
+
+    if (chunk.getSize() > 0)
     {
         CRASH_TRACER_PLUGIN (getDebugName());
 
         if (getNumPrograms() > 1)
             setCurrentProgram (v.getProperty (IDs::programNum), false);
 
-        MemoryBlock chunk;
-        chunk.fromBase64Encoding (s);
-
-        if (chunk.getSize() > 0)
-            callBlocking ([this, &chunk]() { pluginInstance->setStateInformation (chunk.getData(), (int) chunk.getSize()); });
+        callBlocking ([this, &chunk]() { pluginInstance->setStateInformation (chunk.getData(), (int) chunk.getSize()); });
     }
 }
 
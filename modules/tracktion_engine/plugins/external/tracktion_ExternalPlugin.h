@@ -31,6 +31,18 @@ public:
     void initialiseFully() override;
     void forceFullReinitialise();
 
+    /** Returns true if this plugin's instance can be created by instantiateOnBackgroundThread().
+        @see EngineBehaviour::canInstantiatePluginOffMessageThread
+    */
+    bool canInstantiateOnBackgroundThread() const;
+
+    /** Creates the plugin instance and restores its state on the calling thread.
+        This is used by the Edit to load plugins concurrently so doesn't call back to
+        the message thread or touch the state tree. initialiseFully() must still be
+        called afterwards on the loading thread to finish the initialisation.
+    */
+    void instantiateOnBackgroundThread();
+
     static const char* xmlTypeName;
 
     void flushPluginStateToValueTree() override;
@@ -138,6 +150,7 @@ private:
     std::unique_ptr<PluginPlayHead> playhead;
 
     bool fullyInitialised = false, supportsMPE = false, isFlushingLayoutToState = false;
+    std::atomic<bool> instantiatedInBackground { false };
 
     struct MPEChannelRemapper;
     std::unique_ptr<MPEChannelRemapper> mpeRemapper;
@@ -156,6 +169,8 @@ private:
 
     //==============================================================================
     void doFullInitialisation();
+    void initialiseNewInstance();
+    static void getStateChunkFromTree (const juce::ValueTree&, juce::MemoryBlock&);
     void buildParameterList();
     void refreshParameterValues();
     void updateDebugName();
@@ -0,0 +1,1244 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+static const char* sandboxCommandLineUID = "PluginSandbox";
+
+//==============================================================================
+/** The layout of the memory shared between the master and a worker for one plugin.
+    Only plain data and lock-free atomics go in here as it's mapped by both processes.
+*/
+struct SandboxLayout
+{
+    static constexpr int maxChannels = 32;
+    static constexpr int maxBlockSize = 8192;
+    static constexpr int maxMidiEvents = 1024;
+    static constexpr int maxParameterChanges = 512;
+
+    struct PlayHeadState
+    {
+        double bpm, timeInSeconds, editOriginTime, ppqPosition, ppqPositionOfLastBarStart, ppqLoopStart, ppqLoopEnd;
+        juce::int64 timeInSamples;
+        juce::int32 timeSigNumerator, timeSigDenominator, frameRate;
+        juce::uint8 isValid, isPlaying, isRecording, isLooping;
+    };
+
+    struct MidiEvent
+    {
+        juce::int32 samplePosition;
+        juce::uint8 size, data[3];
+    };
+
+    struct ParameterChange
+    {
+        juce::int32 index;
+        float value;
+    };
+
+    struct Header
+    {
+        // The master bumps requestNumber once a block's been written, and the worker
+        // sets replyNumber to the same value once it's been processed. The worker sets
+        // serverWaiting while it's asleep, waiting for requestNumber to change.
+        // nonRealtime is set while the master is rendering offline.
+        std::atomic<juce::uint32> requestNumber, replyNumber, resetRequested, serverWaiting, nonRealtime;
+        juce::int32 numSamples, numChannels, numMidiIn, numMidiOut, numParameterChanges;
+        PlayHeadState playHead;
+    };
+
+    static_assert (sizeof (std::atomic<juce::uint32>) == sizeof (juce::uint32), "The atomics must be lock-free to be shared");
+    static_assert (std::is_standard_layout<Header>::value, "The header must be plain data");
+
+    static constexpr size_t parameterChangesOffset  = sizeof (Header);
+    static constexpr size_t midiInOffset            = parameterChangesOffset + sizeof (ParameterChange) * maxParameterChanges;
+    static constexpr size_t midiOutOffset           = midiInOffset + sizeof (MidiEvent) * maxMidiEvents;
+    static constexpr size_t audioOffset             = midiOutOffset + sizeof (MidiEvent) * maxMidiEvents;
+    static constexpr size_t totalSize               = audioOffset + sizeof (float) * maxChannels * maxBlockSize;
+};
+
+//==============================================================================
+/** A mapping of the shared memory for one plugin. */
+class SandboxSharedBlock
+{
+public:
+    /** Makes a new file of the right size and maps it. This is done by the master. */
+    static std::unique_ptr<SandboxSharedBlock> create (const juce::File& file)
+    {
+        juce::MemoryBlock zeroes (SandboxLayout::totalSize, true);
+
+        if (! file.replaceWithData (zeroes.getData(), zeroes.getSize()))
+            return {};
+
+        auto block = open (file);
+
+        if (block != nullptr)
+            new (&block->getHeader()) SandboxLayout::Header();
+
+        return block;
+    }
+
+    /** Maps a file that the master has already made. */
+    static std::unique_ptr<SandboxSharedBlock> open (const juce::File& file)
+    {
+        auto mappedFile = std::make_unique<juce::MemoryMappedFile> (file, juce::MemoryMappedFile::readWrite, false);
+
+        if (mappedFile->getData() == nullptr || mappedFile->getSize() < SandboxLayout::totalSize)
+            return {};
+
+        return std::unique_ptr<SandboxSharedBlock> (new SandboxSharedBlock (std::move (mappedFile)));
+    }
+
+    SandboxLayout::Header& getHeader() const noexcept                    { return *reinterpret_cast<SandboxLayout::Header*> (data); }
+    SandboxLayout::ParameterChange* getParameterChanges() const noexcept { return reinterpret_cast<SandboxLayout::ParameterChange*> (data + SandboxLayout::parameterChangesOffset); }
+    SandboxLayout::MidiEvent* getMidiIn() const noexcept                 { return reinterpret_cast<SandboxLayout::MidiEvent*> (data + SandboxLayout::midiInOffset); }
+    SandboxLayout::MidiEvent* getMidiOut() const noexcept                { return reinterpret_cast<SandboxLayout::MidiEvent*> (data + SandboxLayout::midiOutOffset); }
+    float* const* getChannels() const noexcept                           { return channels; }
+
+private:
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+    char* data;
+    float* channels[SandboxLayout::maxChannels];
+
+    SandboxSharedBlock (std::unique_ptr<juce::MemoryMappedFile> f)
+        : mappedFile (std::move (f)), data (static_cast<char*> (mappedFile->getData()))
+    {
+        auto audio = reinterpret_cast<float*> (data + SandboxLayout::audioOffset);
+
+        for (int i = 0; i < SandboxLayout::maxChannels; ++i)
+            channels[i] = audio + i * SandboxLayout::maxBlockSize;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (SandboxSharedBlock)
+};
+
+//==============================================================================
+/** Sleeps until a word in the shared memory changes from the expected value, it's
+    woken by wakeSandboxWaiters(), or the timeout passes.
+*/
+static void waitForSandboxWord (std::atomic<juce::uint32>& word, juce::uint32 expected, int timeoutMs)
+{
+   #if JUCE_LINUX
+    // The word's in memory that both processes map, so this can't be a private futex
+    timespec timeout { timeoutMs / 1000, (timeoutMs % 1000) * 1000000L };
+    syscall (SYS_futex, reinterpret_cast<juce::uint32*> (&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+   #else
+    // There's no cross-process equivalent that's safe to signal from the audio
+    // thread, so this just sleeps for as short a time as it can
+    juce::ignoreUnused (word, expected, timeoutMs);
+    juce::Thread::sleep (1);
+   #endif
+}
+
+/** Wakes anything in waitForSandboxWord() on this word. On Linux this is a FUTEX_WAKE
+    system call, which doesn't block, so it's only made when the worker is asleep.
+*/
+static void wakeSandboxWaiters (std::atomic<juce::uint32>& word)
+{
+   #if JUCE_LINUX
+    syscall (SYS_futex, reinterpret_cast<juce::uint32*> (&word), FUTEX_WAKE, std::numeric_limits<int>::max(), nullptr, nullptr, 0);
+   #else
+    juce::ignoreUnused (word);
+   #endif
+}
+
+static juce::File getSandboxMemoryDirectory()
+{
+   #if JUCE_LINUX
+    // This is a RAM disk, so the pages never get written out
+    juce::File shm ("/dev/shm");
+
+    if (shm.isDirectory())
+        return shm;
+   #endif
+
+    return juce::File::getSpecialLocation (juce::File::tempDirectory);
+}
+
+//==============================================================================
+/** The master's end of the shared memory, used from the audio thread. */
+class SandboxClient
+{
+public:
+    SandboxClient (std::unique_ptr<SandboxSharedBlock> b)
+        : block (std::move (b))
+    {
+        pendingParameterChanges.reserve ((size_t) SandboxLayout::maxParameterChanges);
+    }
+
+    /** Queues a parameter change to be sent with the next block. */
+    void addParameterChange (int index, float value) noexcept
+    {
+        if (pendingParameterChanges.size() < (size_t) SandboxLayout::maxParameterChanges)
+            pendingParameterChanges.push_back ({ index, value });
+    }
+
+    /** Asks the plugin to be reset before its next block. */
+    void requestReset() noexcept
+    {
+        block->getHeader().resetRequested = 1;
+    }
+
+    /** Passes on whether the plugin is being rendered offline, from its next block. */
+    void setNonRealtime (bool isNonRealtime) noexcept
+    {
+        block->getHeader().nonRealtime = isNonRealtime ? 1 : 0;
+    }
+
+    /** Sends a block to the worker and waits for it to come back.
+        If it takes longer than the timeout this returns false and the block should be
+        treated as lost. Any block after that is refused until the worker has caught up.
+        A negative timeout waits for as long as the block takes, unless the worker crashes.
+
+        No locks are taken, but if the worker has gone to sleep waiting for a block,
+        waking it takes a system call (a FUTEX_WAKE on Linux), which doesn't block.
+    */
+    bool process (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi,
+                  juce::AudioPlayHead* playHead, double timeoutMs, const std::atomic<bool>& workerCrashed)
+    {
+        auto& header = block->getHeader();
+
+        if (isAwaitingReply && ! waitForReply (timeoutMs < 0.0 ? timeoutMs : 0.0, workerCrashed))
+            return false;
+
+        const int numSamples = juce::jmin (buffer.getNumSamples(), SandboxLayout::maxBlockSize);
+        const int numChannels = juce::jmin (buffer.getNumChannels(), SandboxLayout::maxChannels);
+        header.numSamples = numSamples;
+        header.numChannels = numChannels;
+
+        for (int i = 0; i < numChannels; ++i)
+            juce::FloatVectorOperations::copy (block->getChannels()[i], buffer.getReadPointer (i), numSamples);
+
+        writeMidi (midi, numSamples);
+        writeParameterChanges();
+        writePlayHead (playHead, header.playHead);
+
+        header.requestNumber.store (++lastRequestNumber);
+        isAwaitingReply = true;
+
+        if (header.serverWaiting.load() != 0)
+            wakeSandboxWaiters (header.requestNumber);
+
+        if (! waitForReply (timeoutMs, workerCrashed))
+            return false;
+
+        for (int i = 0; i < numChannels; ++i)
+            juce::FloatVectorOperations::copy (buffer.getWritePointer (i), block->getChannels()[i], numSamples);
+
+        readMidi (midi);
+        return true;
+    }
+
+private:
+    std::unique_ptr<SandboxSharedBlock> block;
+    std::vector<SandboxLayout::ParameterChange> pendingParameterChanges;
+    juce::uint32 lastRequestNumber = 0;
+    bool isAwaitingReply = false;
+
+    bool waitForReply (double timeoutMs, const std::atomic<bool>& workerCrashed)
+    {
+        auto& header = block->getHeader();
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+
+        // Spin for a little while as most blocks come back quickly, then give up the CPU
+        for (int numTries = 0;; ++numTries)
+        {
+            if (header.replyNumber.load (std::memory_order_acquire) == lastRequestNumber)
+            {
+                isAwaitingReply = false;
+                return true;
+            }
+
+            if (numTries > 100)
+            {
+                if (workerCrashed.load())
+                    return false;
+
+                if (timeoutMs >= 0.0
+                     && juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks) * 1000.0 >= timeoutMs)
+                    return false;
+
+                juce::Thread::yield();
+            }
+        }
+    }
+
+    void writeMidi (const juce::MidiBuffer& midi, int numSamples) noexcept
+    {
+        auto events = block->getMidiIn();
+        int numEvents = 0;
+
+        // Only short messages fit in an event so any SysEx is dropped
+        for (auto m : midi)
+        {
+            if (numEvents >= SandboxLayout::maxMidiEvents)
+                break;
+
+            if (m.numBytes <= 3)
+            {
+                auto& e = events[numEvents++];
+                e.samplePosition = juce::jlimit (0, numSamples - 1, m.samplePosition);
+                e.size = (juce::uint8) m.numBytes;
+                std::memcpy (e.data, m.data, (size_t) m.numBytes);
+            }
+        }
+
+        block->getHeader().numMidiIn = numEvents;
+    }
+
+    void readMidi (juce::MidiBuffer& midi) noexcept
+    {
+        midi.clear();
+        auto events = block->getMidiOut();
+        auto numEvents = juce::jmin (block->getHeader().numMidiOut, SandboxLayout::maxMidiEvents);
+
+        for (int i = 0; i < numEvents; ++i)
+            midi.addEvent (events[i].data, events[i].size, events[i].samplePosition);
+    }
+
+    void writeParameterChanges() noexcept
+    {
+        auto changes = block->getParameterChanges();
+        int numChanges = 0;
+
+        for (auto& c : pendingParameterChanges)
+            changes[numChanges++] = c;
+
+        block->getHeader().numParameterChanges = numChanges;
+        pendingParameterChanges.clear();
+    }
+
+    static void writePlayHead (juce::AudioPlayHead* playHead, SandboxLayout::PlayHeadState& state)
+    {
+        juce::AudioPlayHead::CurrentPositionInfo info;
+        state.isValid = playHead != nullptr && playHead->getCurrentPosition (info);
+
+        if (! state.isValid)
+            return;
+
+        state.bpm = info.bpm;
+        state.timeInSeconds = info.timeInSeconds;
+        state.editOriginTime = info.editOriginTime;
+        state.ppqPosition = info.ppqPosition;
+        state.ppqPositionOfLastBarStart = info.ppqPositionOfLastBarStart;
+        state.ppqLoopStart = info.ppqLoopStart;
+        state.ppqLoopEnd = info.ppqLoopEnd;
+        state.timeInSamples = info.timeInSamples;
+        state.timeSigNumerator = info.timeSigNumerator;
+        state.timeSigDenominator = info.timeSigDenominator;
+        state.frameRate = (juce::int32) info.frameRate;
+        state.isPlaying = info.isPlaying;
+        state.isRecording = info.isRecording;
+        state.isLooping = info.isLooping;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (SandboxClient)
+};
+
+//==============================================================================
+/** The worker's end of the shared memory, which processes a plugin on its own thread. */
+class SandboxServer  : private juce::Thread,
+                       private juce::AudioPlayHead
+{
+public:
+    SandboxServer (std::unique_ptr<juce::AudioPluginInstance> p, std::unique_ptr<SandboxSharedBlock> b)
+        : juce::Thread ("Plugin Sandbox"), plugin (std::move (p)), block (std::move (b))
+    {
+        plugin->setPlayHead (this);
+        midi.ensureSize ((size_t) SandboxLayout::maxMidiEvents * 8);
+    }
+
+    ~SandboxServer() override
+    {
+        release();
+    }
+
+    juce::AudioPluginInstance& getPlugin() const noexcept     { return *plugin; }
+
+    /** Prepares the plugin and starts serving blocks. */
+    void prepare (double sampleRate, int blockSize)
+    {
+        release();
+        plugin->setRateAndBufferSizeDetails (sampleRate, blockSize);
+        plugin->prepareToPlay (sampleRate, blockSize);
+        isPrepared = true;
+
+        // Anything sent while the plugin was being prepared is dropped, but the master
+        // needs to see it as answered or it'll keep waiting for it
+        auto& header = block->getHeader();
+        lastRequestNumber = header.requestNumber.load();
+        header.replyNumber.store (lastRequestNumber, std::memory_order_release);
+        startThread (juce::Thread::realtimeAudioPriority);
+    }
+
+    /** Stops serving blocks and releases the plugin. */
+    void release()
+    {
+        signalThreadShouldExit();
+        wakeSandboxWaiters (block->getHeader().requestNumber);
+        stopThread (5000);
+
+        if (isPrepared)
+        {
+            isPrepared = false;
+            plugin->releaseResources();
+        }
+    }
+
+private:
+    std::unique_ptr<juce::AudioPluginInstance> plugin;
+    std::unique_ptr<SandboxSharedBlock> block;
+    juce::MidiBuffer midi;
+    juce::uint32 lastRequestNumber = 0;
+    bool isPrepared = false;
+
+    static constexpr double maxSpinMs = 0.1;
+
+    void run() override
+    {
+        auto& header = block->getHeader();
+        auto spinStartTime = juce::Time::getMillisecondCounterHiRes();
+
+        while (! threadShouldExit())
+        {
+            auto requestNumber = header.requestNumber.load (std::memory_order_acquire);
+
+            if (requestNumber != lastRequestNumber)
+            {
+                processBlock();
+                lastRequestNumber = requestNumber;
+                header.replyNumber.store (requestNumber, std::memory_order_release);
+                spinStartTime = juce::Time::getMillisecondCounterHiRes();
+            }
+            else if (juce::Time::getMillisecondCounterHiRes() - spinStartTime < maxSpinMs)
+            {
+                // A chain of plugins in one callback sends blocks in quick succession,
+                // so it's worth staying awake very briefly
+                juce::Thread::yield();
+            }
+            else
+            {
+                // This is checked again after saying it's waiting, so that a block
+                // sent in between isn't slept through
+                header.serverWaiting.store (1);
+
+                if (header.requestNumber.load() == lastRequestNumber)
+                    waitForSandboxWord (header.requestNumber, lastRequestNumber, 100);
+
+                header.serverWaiting.store (0);
+                spinStartTime = juce::Time::getMillisecondCounterHiRes();
+            }
+        }
+    }
+
+    void processBlock()
+    {
+        auto& header = block->getHeader();
+
+        if (header.resetRequested.exchange (0) != 0)
+            plugin->reset();
+
+        const bool nonRealtime = header.nonRealtime.load() != 0;
+
+        if (nonRealtime != plugin->isNonRealtime())
+            plugin->setNonRealtime (nonRealtime);
+
+        auto& parameters = plugin->getParameters();
+        auto changes = block->getParameterChanges();
+
+        for (int i = 0; i < juce::jmin (header.numParameterChanges, SandboxLayout::maxParameterChanges); ++i)
+            if (auto p = parameters[changes[i].index])
+                p->setValue (changes[i].value);
+
+        const int numSamples = juce::jlimit (0, SandboxLayout::maxBlockSize, header.numSamples);
+        const int numChannels = juce::jlimit (0, SandboxLayout::maxChannels, header.numChannels);
+
+        midi.clear();
+        auto midiIn = block->getMidiIn();
+
+        for (int i = 0; i < juce::jmin (header.numMidiIn, SandboxLayout::maxMidiEvents); ++i)
+            midi.addEvent (midiIn[i].data, midiIn[i].size, midiIn[i].samplePosition);
+
+        // This refers straight to the shared memory so the plugin processes it in place
+        juce::AudioBuffer<float> buffer (block->getChannels(), numChannels, numSamples);
+        plugin->processBlock (buffer, midi);
+
+        auto midiOut = block->getMidiOut();
+        int numMidiOut = 0;
+
+        for (auto m : midi)
+        {
+            if (numMidiOut >= SandboxLayout::maxMidiEvents)
+                break;
+
+            if (m.numBytes <= 3)
+            {
+                auto& e = midiOut[numMidiOut++];
+                e.samplePosition = m.samplePosition;
+                e.size = (juce::uint8) m.numBytes;
+                std::memcpy (e.data, m.data, (size_t) m.numBytes);
+            }
+        }
+
+        header.numMidiOut = numMidiOut;
+    }
+
+    bool getCurrentPosition (CurrentPositionInfo& info) override
+    {
+        auto& state = block->getHeader().playHead;
+
+        if (! state.isValid)
+            return false;
+
+        info.bpm = state.bpm;
+        info.timeInSeconds = state.timeInSeconds;
+        info.editOriginTime = state.editOriginTime;
+        info.ppqPosition = state.ppqPosition;
+        info.ppqPositionOfLastBarStart = state.ppqPositionOfLastBarStart;
+        info.ppqLoopStart = state.ppqLoopStart;
+        info.ppqLoopEnd = state.ppqLoopEnd;
+        info.timeInSamples = state.timeInSamples;
+        info.timeSigNumerator = state.timeSigNumerator;
+        info.timeSigDenominator = state.timeSigDenominator;
+        info.frameRate = (FrameRateType) state.frameRate;
+        info.isPlaying = state.isPlaying != 0;
+        info.isRecording = state.isRecording != 0;
+        info.isLooping = state.isLooping != 0;
+        return true;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (SandboxServer)
+};
+
+//==============================================================================
+/** A gain plugin that's built into the workers, for testing and benchmarking. */
+class SandboxTestPlugin  : public juce::AudioPluginInstance
+{
+public:
+    SandboxTestPlugin()
+        : juce::AudioPluginInstance (BusesProperties().withInput ("Input", juce::AudioChannelSet::stereo())
+                                                      .withOutput ("Output", juce::AudioChannelSet::stereo()))
+    {
+        addParameter (gain = new juce::AudioParameterFloat ("gain", "Gain", 0.0f, 1.0f, 1.0f));
+    }
+
+    void fillInPluginDescription (juce::PluginDescription& d) const override   { d = PluginSandbox::getTestPluginDescription(); }
+    const juce::String getName() const override                                 { return PluginSandbox::getTestPluginDescription().name; }
+
+    void prepareToPlay (double, int) override {}
+    void releaseResources() override {}
+
+    void processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&) override
+    {
+        buffer.applyGain (gain->get());
+    }
+
+    double getTailLengthSeconds() const override                    { return 0.0; }
+    bool acceptsMidi() const override                               { return true; }
+    bool producesMidi() const override                              { return true; }
+    juce::AudioProcessorEditor* createEditor() override             { return nullptr; }
+    bool hasEditor() const override                                 { return false; }
+    int getNumPrograms() override                                   { return 1; }
+    int getCurrentProgram() override                                { return 0; }
+    void setCurrentProgram (int) override                           {}
+    const juce::String getProgramName (int) override                { return {}; }
+    void changeProgramName (int, const juce::String&) override      {}
+
+    void getStateInformation (juce::MemoryBlock& mb) override
+    {
+        juce::MemoryOutputStream (mb, false).writeFloat (gain->get());
+    }
+
+    void setStateInformation (const void* data, int size) override
+    {
+        if (size >= (int) sizeof (float))
+            *gain = juce::MemoryInputStream (data, (size_t) size, false).readFloat();
+    }
+
+private:
+    juce::AudioParameterFloat* gain = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SandboxTestPlugin)
+};
+
+//==============================================================================
+/** Runs in a worker process, loading plugins and serving them to the master. */
+struct PluginSandboxSlaveProcess  : public juce::ChildProcessSlave,
+                                    private juce::AsyncUpdater
+{
+    PluginSandboxSlaveProcess()
+    {
+        pluginFormatManager.addDefaultFormats();
+    }
+
+    void handleConnectionMade() override {}
+
+    void handleConnectionLost() override
+    {
+        // This is called on the connection's thread while the plugins' threads are
+        // still running, so it quits without running any static destructors
+        std::_Exit (0);
+    }
+
+private:
+    juce::AudioPluginFormatManager pluginFormatManager;
+    std::map<int, std::unique_ptr<SandboxServer>> servers;
+    juce::OwnedArray<juce::XmlElement, juce::CriticalSection> pendingMessages;
+
+    std::unique_ptr<juce::AudioPluginInstance> createPlugin (const juce::PluginDescription& desc, double rate,
+                                                             int blockSize, juce::String& error)
+    {
+        if (desc.pluginFormatName == PluginSandbox::getTestPluginDescription().pluginFormatName)
+            return std::make_unique<SandboxTestPlugin>();
+
+        return std::unique_ptr<juce::AudioPluginInstance> (pluginFormatManager.createPluginInstance (desc, rate, blockSize, error));
+    }
+
+    static void addPluginDetails (juce::AudioPluginInstance& plugin, juce::XmlElement& reply)
+    {
+        reply.setAttribute ("numInputs", plugin.getTotalNumInputChannels());
+        reply.setAttribute ("numOutputs", plugin.getTotalNumOutputChannels());
+        reply.setAttribute ("latency", plugin.getLatencySamples());
+        reply.setAttribute ("tail", plugin.getTailLengthSeconds());
+        reply.setAttribute ("acceptsMidi", plugin.acceptsMidi());
+        reply.setAttribute ("producesMidi", plugin.producesMidi());
+        reply.setAttribute ("program", plugin.getCurrentProgram());
+
+        for (auto p : plugin.getParameters())
+        {
+            auto e = reply.createNewChildElement ("PARAM");
+            e->setAttribute ("name", p->getName (1024));
+            e->setAttribute ("label", p->getLabel());
+            e->setAttribute ("default", p->getDefaultValue());
+            e->setAttribute ("value", p->getValue());
+            e->setAttribute ("steps", p->getNumSteps());
+        }
+
+        for (int i = 0; i < plugin.getNumPrograms(); ++i)
+            reply.createNewChildElement ("PROGRAM")->setAttribute ("name", plugin.getProgramName (i));
+
+        juce::MemoryBlock state;
+        plugin.getStateInformation (state);
+        reply.setAttribute ("state", state.toBase64Encoding());
+    }
+
+    void handleLoad (const juce::XmlElement& m, juce::XmlElement& reply)
+    {
+        juce::PluginDescription desc;
+        juce::String error;
+        auto rate = m.getDoubleAttribute ("rate");
+        auto blockSize = m.getIntAttribute ("blockSize");
+
+        if (auto descXml = m.getChildElement (0))
+            desc.loadFromXml (*descXml);
+
+        auto plugin = createPlugin (desc, rate, blockSize, error);
+        auto sharedBlock = SandboxSharedBlock::open (juce::File (m.getStringAttribute ("memory")));
+
+        if (plugin == nullptr || sharedBlock == nullptr)
+        {
+            reply.setAttribute ("error", error.isNotEmpty() ? error : juce::String ("Couldn't load the plugin"));
+            return;
+        }
+
+        plugin->enableAllBuses();
+
+        auto server = std::make_unique<SandboxServer> (std::move (plugin), std::move (sharedBlock));
+        server->prepare (rate, blockSize);
+
+        reply.setAttribute ("ok", true);
+        addPluginDetails (server->getPlugin(), reply);
+        servers[m.getIntAttribute ("instance")] = std::move (server);
+    }
+
+    void handleMessage (const juce::XmlElement& m)
+    {
+        juce::XmlElement reply ("REPLY");
+        reply.setAttribute ("id", m.getIntAttribute ("id"));
+
+        if (m.hasTagName ("LOAD"))
+        {
+            handleLoad (m, reply);
+        }
+        else
+        {
+            auto found = servers.find (m.getIntAttribute ("instance"));
+
+            if (found != servers.end())
+            {
+                auto& server = *found->second;
+                auto& plugin = server.getPlugin();
+
+                if (m.hasTagName ("PREPARE"))
+                {
+                    server.prepare (m.getDoubleAttribute ("rate"), m.getIntAttribute ("blockSize"));
+                }
+                else if (m.hasTagName ("RELEASE"))
+                {
+                    server.release();
+                }
+                else if (m.hasTagName ("GETSTATE"))
+                {
+                    juce::MemoryBlock state;
+                    plugin.getStateInformation (state);
+                    reply.setAttribute ("state", state.toBase64Encoding());
+                }
+                else if (m.hasTagName ("SETSTATE"))
+                {
+                    juce::MemoryBlock state;
+
+                    if (state.fromBase64Encoding (m.getStringAttribute ("state")))
+                        plugin.setStateInformation (state.getData(), (int) state.getSize());
+                }
+                else if (m.hasTagName ("SETPROGRAM"))
+                {
+                    plugin.setCurrentProgram (m.getIntAttribute ("program"));
+                }
+                else if (m.hasTagName ("UNLOAD"))
+                {
+                    servers.erase (found);
+                    sendMessageToMaster (createScanMessage (reply));
+                    return;
+                }
+
+                reply.setAttribute ("latency", plugin.getLatencySamples());
+            }
+        }
+
+        sendMessageToMaster (createScanMessage (reply));
+    }
+
+    void handleMessageFromMaster (const juce::MemoryBlock& mb) override
+    {
+        if (auto xml = std::unique_ptr<juce::XmlElement> (juce::XmlDocument::parse (mb.toString())))
+        {
+            pendingMessages.add (xml.release());
+            triggerAsyncUpdate();
+        }
+    }
+
+    void handleAsyncUpdate() override
+    {
+        // Plugins expect to be created and have their state set on the message thread
+        while (pendingMessages.size() > 0)
+            if (auto xml = std::unique_ptr<juce::XmlElement> (pendingMessages.removeAndReturn (0)))
+                handleMessage (*xml);
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginSandboxSlaveProcess)
+};
+
+//==============================================================================
+/** The master's connection to one worker process. */
+struct PluginSandboxWorker  : public juce::ReferenceCountedObject,
+                              private juce::ChildProcessMaster
+{
+    using Ptr = juce::ReferenceCountedObjectPtr<PluginSandboxWorker>;
+
+    PluginSandboxWorker() = default;
+
+    bool launch()
+    {
+        return launchSlaveProcess (juce::File::getSpecialLocation (juce::File::currentExecutableFile),
+                                   sandboxCommandLineUID, 0, 0);
+    }
+
+    /** Sends a message and waits for the worker to reply to it.
+        Returns nullptr if it times out or the worker has crashed.
+    */
+    std::unique_ptr<juce::XmlElement> sendAndWait (juce::XmlElement& message, int timeoutMs)
+    {
+        if (crashed)
+            return {};
+
+        const int requestID = ++nextRequestID;
+        message.setAttribute ("id", requestID);
+
+        {
+            const juce::ScopedLock sl (replyLock);
+            awaitedRequestIDs.add (requestID);
+        }
+
+        // Once this returns, a reply to the request is of no use, so it's dropped when it arrives
+        auto stopWaiting = [this, requestID]
+        {
+            const juce::ScopedLock sl (replyLock);
+            awaitedRequestIDs.removeFirstMatchingValue (requestID);
+        };
+
+        if (! sendMessageToSlave (createScanMessage (message)))
+        {
+            stopWaiting();
+            return {};
+        }
+
+        const auto endTime = juce::Time::getMillisecondCounter() + (juce::uint32) timeoutMs;
+
+        for (;;)
+        {
+            {
+                const juce::ScopedLock sl (replyLock);
+
+                for (int i = replies.size(); --i >= 0;)
+                {
+                    if (replies.getUnchecked (i)->getIntAttribute ("id") == requestID)
+                    {
+                        awaitedRequestIDs.removeFirstMatchingValue (requestID);
+                        return std::unique_ptr<juce::XmlElement> (replies.removeAndReturn (i));
+                    }
+                }
+            }
+
+            auto now = juce::Time::getMillisecondCounter();
+
+            if (crashed || now >= endTime)
+            {
+                stopWaiting();
+                return {};
+            }
+
+            // Several threads might be waiting, so this doesn't rely on being the one woken
+            replyArrived.wait ((int) juce::jmin ((juce::uint32) 50, endTime - now));
+        }
+    }
+
+    std::atomic<bool> crashed { false };
+    std::atomic<int> numInstances { 0 }, numLateBlocks { 0 };
+
+private:
+    juce::OwnedArray<juce::XmlElement> replies;
+    juce::Array<int> awaitedRequestIDs;
+    juce::CriticalSection replyLock;
+    juce::WaitableEvent replyArrived;
+    std::atomic<int> nextRequestID { 0 };
+
+    void handleMessageFromSlave (const juce::MemoryBlock& mb) override
+    {
+        if (auto xml = std::unique_ptr<juce::XmlElement> (juce::XmlDocument::parse (mb.toString())))
+        {
+            const juce::ScopedLock sl (replyLock);
+
+            if (awaitedRequestIDs.contains (xml->getIntAttribute ("id")))
+                replies.add (xml.release());
+        }
+
+        replyArrived.signal();
+    }
+
+    void handleConnectionLost() override
+    {
+        if (! crashed.exchange (true))
+            TRACKTION_LOG_ERROR ("Plugin sandbox process crashed with " + juce::String (numInstances.load()) + " plugins loaded");
+
+        replyArrived.signal();
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginSandboxWorker)
+};
+
+//==============================================================================
+/** Stands in for a plugin that's running in a worker process. */
+class SandboxedPluginInstance  : public juce::AudioPluginInstance
+{
+public:
+    SandboxedPluginInstance (DeviceManager& dm, PluginSandboxWorker& w, int id, const juce::File& memory,
+                             std::unique_ptr<SandboxClient> c, const juce::PluginDescription& desc,
+                             const juce::XmlElement& details)
+        : juce::AudioPluginInstance (getBusesProperties (details)),
+          deviceManager (dm), worker (&w), instanceID (id), memoryFile (memory), client (std::move (c)), description (desc),
+          tailLength (details.getDoubleAttribute ("tail")),
+          isMidiInput (details.getBoolAttribute ("acceptsMidi")),
+          isMidiOutput (details.getBoolAttribute ("producesMidi")),
+          currentProgram (details.getIntAttribute ("program"))
+    {
+        ++worker->numInstances;
+        setLatencySamples (details.getIntAttribute ("latency"));
+
+        forEachXmlChildElementWithTagName (details, e, "PARAM")
+            addParameter (new Parameter (*this, *e));
+
+        forEachXmlChildElementWithTagName (details, e, "PROGRAM")
+            programNames.add (e->getStringAttribute ("name"));
+
+        lastGoodState.fromBase64Encoding (details.getStringAttribute ("state"));
+    }
+
+    ~SandboxedPluginInstance() override
+    {
+        juce::XmlElement m ("UNLOAD");
+        send (m, 2000);
+        --worker->numInstances;
+
+        client.reset();
+        memoryFile.deleteFile();
+    }
+
+    //==============================================================================
+    void fillInPluginDescription (juce::PluginDescription& d) const override   { d = description; }
+    const juce::String getName() const override                                 { return description.name; }
+
+    void prepareToPlay (double sampleRate, int blockSize) override
+    {
+        juce::XmlElement m ("PREPARE");
+        m.setAttribute ("rate", sampleRate);
+        m.setAttribute ("blockSize", blockSize);
+        send (m, 10000);
+    }
+
+    void releaseResources() override
+    {
+        juce::XmlElement m ("RELEASE");
+        send (m, 10000);
+    }
+
+    void reset() override
+    {
+        client->requestReset();
+    }
+
+    void setNonRealtime (bool isNonRealtime) noexcept override
+    {
+        juce::AudioPluginInstance::setNonRealtime (isNonRealtime);
+        client->setNonRealtime (isNonRealtime);
+    }
+
+    void processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi) override
+    {
+        if (! worker->crashed)
+        {
+            if (anyParameterChanged.exchange (false))
+                for (auto p : getParameters())
+                    if (static_cast<Parameter*> (p)->hasChanged.exchange (false))
+                        client->addParameterChange (p->getParameterIndex(), p->getValue());
+
+            if (client->process (buffer, midi, getPlayHead(), getTimeoutMs (buffer.getNumSamples()), worker->crashed))
+                return;
+
+            ++worker->numLateBlocks;
+        }
+
+        buffer.clear();
+        midi.clear();
+    }
+
+    //==============================================================================
+    bool isBusesLayoutSupported (const BusesLayout& layout) const override
+    {
+        // The worker's plugin has already chosen its layout, so it can't be changed from here
+        return layout.getMainInputChannels() == getMainBusNumInputChannels()
+                && layout.getMainOutputChannels() == getMainBusNumOutputChannels();
+    }
+
+    double getTailLengthSeconds() const override                { return tailLength; }
+    bool acceptsMidi() const override                           { return isMidiInput; }
+    bool producesMidi() const override                          { return isMidiOutput; }
+    juce::AudioProcessorEditor* createEditor() override         { return nullptr; }
+    bool hasEditor() const override                             { return false; }
+
+    int getNumPrograms() override                               { return programNames.size(); }
+    int getCurrentProgram() override                            { return currentProgram; }
+    const juce::String getProgramName (int index) override      { return programNames[index]; }
+    void changeProgramName (int, const juce::String&) override  {}
+
+    void setCurrentProgram (int index) override
+    {
+        currentProgram = index;
+        juce::XmlElement m ("SETPROGRAM");
+        m.setAttribute ("program", index);
+        send (m, 10000);
+    }
+
+    void getStateInformation (juce::MemoryBlock& state) override
+    {
+        juce::XmlElement m ("GETSTATE");
+
+        // If the worker's crashed or stopped responding, the last state it gave is
+        // returned so that saving the Edit doesn't wipe the plugin's settings
+        if (auto reply = send (m, 10000))
+        {
+            juce::MemoryBlock newState;
+
+            if (newState.fromBase64Encoding (reply->getStringAttribute ("state")))
+                lastGoodState = std::move (newState);
+        }
+
+        state = lastGoodState;
+    }
+
+    void setStateInformation (const void* data, int size) override
+    {
+        lastGoodState = juce::MemoryBlock (data, (size_t) size);
+
+        juce::XmlElement m ("SETSTATE");
+        m.setAttribute ("state", lastGoodState.toBase64Encoding());
+        send (m, 10000);
+    }
+
+private:
+    //==============================================================================
+    /** A copy of one of the plugin's parameters. Changes are sent with the next block. */
+    struct Parameter  : public juce::AudioProcessorParameter
+    {
+        Parameter (SandboxedPluginInstance& o, const juce::XmlElement& e)
+            : owner (o),
+              name (e.getStringAttribute ("name")), label (e.getStringAttribute ("label")),
+              defaultValue ((float) e.getDoubleAttribute ("default")),
+              numSteps (e.getIntAttribute ("steps", AudioProcessor::getDefaultNumParameterSteps())),
+              value ((float) e.getDoubleAttribute ("value"))
+        {
+        }
+
+        float getValue() const override                                     { return value.load(); }
+        float getDefaultValue() const override                              { return defaultValue; }
+        juce::String getName (int maximumStringLength) const override       { return name.substring (0, maximumStringLength); }
+        juce::String getLabel() const override                              { return label; }
+        int getNumSteps() const override                                    { return numSteps; }
+        float getValueForText (const juce::String& text) const override     { return juce::jlimit (0.0f, 1.0f, text.getFloatValue()); }
+
+        void setValue (float newValue) override
+        {
+            value = newValue;
+            hasChanged = true;
+            owner.anyParameterChanged = true;
+        }
+
+        SandboxedPluginInstance& owner;
+        const juce::String name, label;
+        const float defaultValue;
+        const int numSteps;
+        std::atomic<float> value;
+        std::atomic<bool> hasChanged { false };
+    };
+
+    DeviceManager& deviceManager;
+    PluginSandboxWorker::Ptr worker;
+    const int instanceID;
+    juce::File memoryFile;
+    std::unique_ptr<SandboxClient> client;
+    const juce::PluginDescription description;
+    const double tailLength;
+    const bool isMidiInput, isMidiOutput;
+    int currentProgram;
+    juce::StringArray programNames;
+    juce::MemoryBlock lastGoodState;
+    std::atomic<bool> anyParameterChanged { false };
+
+    /** Returns how long a block can be waited for, or -1 to wait for as long as it takes.
+        Several sandboxed plugins can be processed in one callback, so this is limited by
+        the time left in the callback as well as the length of the block.
+    */
+    double getTimeoutMs (int numSamples) const
+    {
+        // Offline renders wait for every block, so they come out the same however long the plugin takes
+        if (isNonRealtime())
+            return -1.0;
+
+        auto rate = getSampleRate() > 0.0 ? getSampleRate() : 44100.0;
+        auto blockMs = 1000.0 * numSamples / rate;
+
+        // This is 0 unless it's the device's callback thread that's processing the plugin
+        if (auto deadline = deviceManager.getCurrentCallbackDeadline())
+        {
+            // Some of the block is left for whatever comes after this plugin
+            auto msLeft = juce::Time::highResolutionTicksToSeconds (deadline - juce::Time::getHighResolutionTicks()) * 1000.0;
+            return juce::jlimit (0.0, blockMs, msLeft - 0.1 * blockMs);
+        }
+
+        return blockMs;
+    }
+
+    static BusesProperties getBusesProperties (const juce::XmlElement& details)
+    {
+        BusesProperties buses;
+        auto numInputs = juce::jmin (details.getIntAttribute ("numInputs"), SandboxLayout::maxChannels);
+        auto numOutputs = juce::jmin (details.getIntAttribute ("numOutputs"), SandboxLayout::maxChannels);
+
+        if (numInputs > 0)
+            buses = buses.withInput ("Input", juce::AudioChannelSet::canonicalChannelSet (numInputs));
+
+        if (numOutputs > 0)
+            buses = buses.withOutput ("Output", juce::AudioChannelSet::canonicalChannelSet (numOutputs));
+
+        return buses;
+    }
+
+    std::unique_ptr<juce::XmlElement> send (juce::XmlElement& message, int timeoutMs)
+    {
+        message.setAttribute ("instance", instanceID);
+        auto reply = worker->sendAndWait (message, timeoutMs);
+
+        if (reply != nullptr && reply->hasAttribute ("latency"))
+            setLatencySamples (reply->getIntAttribute ("latency"));
+
+        return reply;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SandboxedPluginInstance)
+};
+
+//==============================================================================
+PluginSandbox::PluginSandbox (Engine& e)  : engine (e) {}
+PluginSandbox::~PluginSandbox() {}
+
+std::unique_ptr<juce::AudioPluginInstance> PluginSandbox::createPluginInstance (const juce::PluginDescription& description,
+                                                                                double sampleRate, int blockSize,
+                                                                                juce::String& errorMessage)
+{
+    CRASH_TRACER
+    PluginSandboxWorker::Ptr worker (getWorkerForNewInstance());
+
+    if (worker == nullptr)
+    {
+        errorMessage = TRANS("Couldn't start a process to load the plugin in");
+        return {};
+    }
+
+    auto memoryFile = getSandboxMemoryDirectory().getNonexistentChildFile ("tracktion_plugin", ".shm", false);
+    auto sharedBlock = SandboxSharedBlock::create (memoryFile);
+
+    if (sharedBlock == nullptr)
+    {
+        memoryFile.deleteFile();
+        errorMessage = TRANS("Couldn't create the memory to share with the plugin's process");
+        return {};
+    }
+
+    const int instanceID = ++nextInstanceID;
+
+    juce::XmlElement m ("LOAD");
+    m.setAttribute ("instance", instanceID);
+    m.setAttribute ("memory", memoryFile.getFullPathName());
+    m.setAttribute ("rate", sampleRate);
+    m.setAttribute ("blockSize", blockSize);
+    m.addChildElement (description.createXml().release());
+
+    // Some plugins take a long time to load, e.g. if they're checking a licence
+    auto reply = worker->sendAndWait (m, 60000);
+
+    if (reply == nullptr || ! reply->getBoolAttribute ("ok"))
+    {
+        memoryFile.deleteFile();
+        errorMessage = reply != nullptr ? reply->getStringAttribute ("error")
+                                        : TRANS("The plugin's process stopped responding");
+        return {};
+    }
+
+    return std::make_unique<SandboxedPluginInstance> (engine.getDeviceManager(), *worker, instanceID, memoryFile,
+                                                      std::make_unique<SandboxClient> (std::move (sharedBlock)),
+                                                      description, *reply);
+}
+
+PluginSandboxWorker* PluginSandbox::getWorkerForNewInstance()
+{
+    const juce::ScopedLock sl (workerLock);
+
+    for (int i = workers.size(); --i >= 0;)
+    {
+        if (workers.getUnchecked (i)->crashed)
+        {
+            workers.remove (i);
+            ++numCrashes;
+        }
+    }
+
+    PluginSandboxWorker* leastUsed = nullptr;
+
+    for (auto w : workers)
+        if (leastUsed == nullptr || w->numInstances.load() < leastUsed->numInstances.load())
+            leastUsed = w;
+
+    // Only start another process once the existing ones all have something to do
+    if (leastUsed == nullptr
+         || (leastUsed->numInstances.load() > 0
+              && workers.size() < engine.getEngineBehaviour().getNumberOfPluginSandboxProcesses()))
+    {
+        PluginSandboxWorker::Ptr newWorker (new PluginSandboxWorker());
+
+        if (newWorker->launch())
+        {
+            TRACKTION_LOG ("----- Launched Plugin Sandbox Process");
+            workers.add (newWorker);
+            leastUsed = newWorker.get();
+        }
+        else
+        {
+            TRACKTION_LOG_ERROR ("Failed to launch plugin sandbox process");
+        }
+    }
+
+    return leastUsed;
+}
+
+bool PluginSandbox::canSandbox (const juce::PluginDescription& desc)
+{
+    auto& format = desc.pluginFormatName;
+
+    return format == getTestPluginDescription().pluginFormatName
+            || format.containsIgnoreCase ("VST")
+            || format.containsIgnoreCase ("AudioUnit")
+            || format.containsIgnoreCase ("LADSPA");
+}
+
+PluginSandbox::Stats PluginSandbox::getStats() const
+{
+    const juce::ScopedLock sl (workerLock);
+    Stats stats;
+    stats.numCrashes = numCrashes.load();
+
+    for (auto w : workers)
+    {
+        if (w->crashed)
+        {
+            ++stats.numCrashes;
+            continue;
+        }
+
+        ++stats.numProcesses;
+        stats.numInstances += w->numInstances.load();
+        stats.numLateBlocks += w->numLateBlocks.load();
+    }
+
+    return stats;
+}
+
+juce::PluginDescription PluginSandbox::getTestPluginDescription()
+{
+    juce::PluginDescription desc;
+    desc.name = "Sandbox Test";
+    desc.descriptiveName = "A gain plugin for testing the plugin sandbox";
+    desc.pluginFormatName = "Sandbox";
+    desc.category = "Utility";
+    desc.manufacturerName = "Tracktion";
+    desc.fileOrIdentifier = "SandboxTest";
+    desc.uid = 0x5a4d0001;
+    desc.numInputChannels = 2;
+    desc.numOutputChannels = 2;
+    return desc;
+}
+
+bool PluginSandbox::startChildProcess (const juce::String& commandLine)
+{
+    auto slave = std::make_unique<PluginSandboxSlaveProcess>();
+
+    if (slave->initialiseFromCommandLine (commandLine, sandboxCommandLineUID))
+    {
+       #if JUCE_MAC
+        setupSignalHandling();
+       #endif
+
+        slave.release(); // allow the slave object to stay alive - it'll handle its own deletion.
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace tracktion_engine
@@ -0,0 +1,89 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+struct PluginSandboxWorker;
+
+//==============================================================================
+/**
+    Runs external plugins in separate worker processes, so a plugin that crashes or
+    takes too long can't hold up the audio callback.
+
+    The plugins are shared out between a few processes, and each one runs on its own
+    realtime thread in its process, so heavy plugins spread across the cores. Each block's
+    audio, MIDI, parameter changes and playhead position go to and from the worker through
+    memory that both processes map, so nothing is locked while processing. A worker that's
+    been idle goes to sleep, and on Linux waking it costs the audio thread a FUTEX_WAKE
+    system call, which doesn't block. Loading plugins and getting or setting their state
+    goes through the same child process messages that plugin scanning uses.
+
+    If a plugin doesn't return a block in time, or its process has crashed, that block
+    is silent and the plugin carries on from the next one. When the plugin's been set to
+    non-realtime for an offline render, every block is waited for unless the process
+    crashes, and the plugin in the worker is set to non-realtime too.
+
+    The app needs to pass its command line to PluginManager::startChildProcessPluginSandbox()
+    when it starts, as it does for PluginManager::startChildProcessPluginScan().
+
+    @see PluginManager::setUsesSandboxForPlugins, EngineBehaviour::canHostPluginsOutOfProcess
+*/
+class PluginSandbox
+{
+public:
+    PluginSandbox (Engine&);
+    ~PluginSandbox();
+
+    /** Loads a plugin in one of the worker processes and returns a proxy for it.
+        The proxy doesn't have an editor. If the plugin can't be loaded, this returns
+        nullptr and sets the error message.
+    */
+    std::unique_ptr<juce::AudioPluginInstance> createPluginInstance (const juce::PluginDescription&,
+                                                                     double sampleRate, int blockSize,
+                                                                     juce::String& errorMessage);
+
+    /** Returns true if this description should be loaded in the sandbox, which is the
+        case for the same formats that are scanned out of process.
+    */
+    static bool canSandbox (const juce::PluginDescription&);
+
+    /** Starts serving plugins if the command line is one the sandbox launched. */
+    static bool startChildProcess (const juce::String& commandLine);
+
+    /** Describes a simple gain plugin built into the worker processes. This can be
+        loaded to measure the cost of the round trip to a worker.
+    */
+    static juce::PluginDescription getTestPluginDescription();
+
+    //==============================================================================
+    struct Stats
+    {
+        int numProcesses = 0;       /**< The number of worker processes running. */
+        int numInstances = 0;       /**< The number of plugins loaded in them. */
+        int numLateBlocks = 0;      /**< Blocks that were silenced as a plugin took too long. */
+        int numCrashes = 0;         /**< The number of worker processes that have crashed. */
+    };
+
+    /** Returns some numbers that show how well the sandbox is coping. */
+    Stats getStats() const;
+
+private:
+    Engine& engine;
+    juce::ReferenceCountedArray<PluginSandboxWorker> workers;
+    juce::CriticalSection workerLock;
+    std::atomic<int> nextInstanceID { 0 }, numCrashes { 0 };
+
+    PluginSandboxWorker* getWorkerForNewInstance();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginSandbox)
+};
+
+} // namespace tracktion_engine
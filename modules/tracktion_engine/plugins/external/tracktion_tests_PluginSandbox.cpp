@@ -0,0 +1,92 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+#if TRACKTION_UNIT_TESTS
+
+class PluginSandboxTests    : public juce::UnitTest
+{
+public:
+    PluginSandboxTests()
+        : juce::UnitTest ("PluginSandboxTests", "Tracktion:Longer") {}
+
+    //==============================================================================
+    void runTest() override
+    {
+        // Both ends run in this process so this measures the shared memory transport
+        // without needing the app to launch worker processes
+        beginTest ("Round trip through shared memory");
+        {
+            constexpr int numBlocks = 10000, blockSize = 256;
+            constexpr double sampleRate = 44100.0;
+
+            auto memoryFile = getSandboxMemoryDirectory().getNonexistentChildFile ("tracktion_plugin_test", ".shm", false);
+            auto clientBlock = SandboxSharedBlock::create (memoryFile);
+            expect (clientBlock != nullptr, "Couldn't create the shared memory");
+
+            if (clientBlock == nullptr)
+                return;
+
+            SandboxServer server (std::make_unique<SandboxTestPlugin>(), SandboxSharedBlock::open (memoryFile));
+            server.prepare (sampleRate, blockSize);
+
+            SandboxClient client (std::move (clientBlock));
+            client.addParameterChange (0, 0.5f);
+
+            juce::AudioBuffer<float> buffer (2, blockSize);
+            juce::MidiBuffer midi;
+            double totalMs = 0.0, maxMs = 0.0;
+            int numLate = 0;
+            bool allProcessed = true, midiPassedThrough = true;
+
+            for (int i = 0; i < numBlocks; ++i)
+            {
+                for (int chan = 0; chan < buffer.getNumChannels(); ++chan)
+                    juce::FloatVectorOperations::fill (buffer.getWritePointer (chan), 1.0f, blockSize);
+
+                midi.clear();
+                midi.addEvent (juce::MidiMessage::noteOn (1, 60, 0.5f), i % blockSize);
+
+                const auto startTicks = juce::Time::getHighResolutionTicks();
+
+                if (! client.process (buffer, midi, nullptr, 1000.0 * blockSize / sampleRate))
+                {
+                    ++numLate;
+                    continue;
+                }
+
+                auto ms = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks) * 1000.0;
+                totalMs += ms;
+                maxMs = juce::jmax (maxMs, ms);
+
+                allProcessed = allProcessed && buffer.getSample (0, 0) == 0.5f && buffer.getSample (1, blockSize - 1) == 0.5f;
+                midiPassedThrough = midiPassedThrough && midi.getNumEvents() == 1;
+            }
+
+            server.release();
+            memoryFile.deleteFile();
+
+            logMessage ("Round trip: average " + juce::String (totalMs / juce::jmax (1, numBlocks - numLate), 4)
+                         + "ms, max " + juce::String (maxMs, 4) + "ms, late blocks: " + juce::String (numLate));
+
+            expect (allProcessed, "The plugin's gain wasn't applied");
+            expect (midiPassedThrough, "MIDI didn't make it through the plugin");
+            expectLessThan (numLate, numBlocks / 100);
+        }
+    }
+};
+
+static PluginSandboxTests pluginSandboxTests;
+
+#endif // TRACKTION_UNIT_TESTS
+
+}
@@ -515,7 +515,7 @@ struct RackType::RenderContext
                   bool isRendering)
     {
        #if ENABLE_EXPERIMENTAL_TRACKTION_GRAPH
-        if (processor)
+        if (processor != nullptr || multiThreadedProcessor != nullptr)
         {
             processExperiemntal (playhead, playheadOutputTime,
                                  outputBuffer, inputBuffer,
@@ -548,15 +548,44 @@ private:
    #if ENABLE_EXPERIMENTAL_TRACKTION_GRAPH
     std::shared_ptr<InputProvider> inputProvider;
     std::unique_ptr<RackNodePlayer<NodePlayer>> processor;
+    std::unique_ptr<RackNodePlayer<tracktion_graph::MultiThreadedNodePlayer>> multiThreadedProcessor;
    #endif
 
    #if ENABLE_EXPERIMENTAL_TRACKTION_GRAPH
+    /** Returns the most plugins and modifiers found at the same depth in the graph.
+        These don't depend on each other so it's roughly how many can be processed at once,
+        e.g. the number of bands in a multiband split.
+    */
+    static size_t getMaxNumParallelItems (tracktion_graph::Node& rootNode)
+    {
+        std::unordered_map<tracktion_graph::Node*, size_t> depths;
+        std::unordered_map<size_t, size_t> numItemsAtDepth;
+        size_t maxNumItems = 0;
+
+        // These are post-ordered so a node's inputs always come before it
+        for (auto node : tracktion_graph::getNodes (rootNode, tracktion_graph::VertexOrdering::postordering))
+        {
+            size_t depth = 0;
+
+            for (auto input : node->getDirectInputNodes())
+                depth = std::max (depth, depths[input] + 1);
+
+            depths[node] = depth;
+
+            if (dynamic_cast<PluginNode*> (node) != nullptr || dynamic_cast<ModifierNode*> (node) != nullptr)
+                maxNumItems = std::max (maxNumItems, ++numItemsAtDepth[depth]);
+        }
+
+        return maxNumItems;
+    }
+
     void createExperiemntalProcessor (RackType& type)
     {
         if (type.sampleRate == 0.0 || type.blockSize == 0
             || type.numActiveInstances.load() == 0)
         {
             processor.reset();
+            multiThreadedProcessor.reset();
             inputProvider.reset();
            return;
         }
@@ -565,9 +594,35 @@ private:
         auto rackNode = RackNodeBuilder::createRackNode (type, type.sampleRate, type.blockSize, inputProvider);
         jassert (tracktion_graph::test_utilities::areNodeIDsUnique (*rackNode, true));
 
-        processor = std::make_unique<RackNodePlayer<NodePlayer>> (std::move (rackNode), inputProvider, false);
-        processor->prepareToPlay (type.sampleRate, type.blockSize);
-        latencySeconds = processor->getLatencySamples() / type.sampleRate;
+        // Only racks with parallel chains are worth the cost of handing nodes to other threads
+        auto& behaviour = type.edit.engine.getEngineBehaviour();
+        const int numParallelItems = (int) getMaxNumParallelItems (*rackNode);
+        const int numThreads = jmin (numParallelItems, behaviour.getNumberOfCPUsToUseForAudio()) - 1;
+
+        if (numThreads > 0)
+        {
+            multiThreadedProcessor = std::make_unique<RackNodePlayer<tracktion_graph::MultiThreadedNodePlayer>> (std::move (rackNode), inputProvider, false);
+
+            auto& player = multiThreadedProcessor->getNodePlayer();
+            player.setMaxNumThreads ((size_t) numThreads);
+            player.setWorkersSleepBetweenBlocks (true);
+
+            // These get the engine's priority but aren't pinned, as the engine's own
+            // workers are pinned to those CPUs and one of them is running this rack
+            player.setThreadInitialiser ([options = behaviour.getAudioWorkerThreadOptions()] (size_t)
+                                         {
+                                             AudioWorkerThreads::configureCurrentThreadAsWorker (options, -1);
+                                         });
+
+            multiThreadedProcessor->prepareToPlay (type.sampleRate, type.blockSize);
+            latencySeconds = multiThreadedProcessor->getLatencySamples() / type.sampleRate;
+        }
+        else
+        {
+            processor = std::make_unique<RackNodePlayer<NodePlayer>> (std::move (rackNode), inputProvider, false);
+            processor->prepareToPlay (type.sampleRate, type.blockSize);
+            latencySeconds = processor->getLatencySamples() / type.sampleRate;
+        }
     }
    #endif
 
@@ -632,7 +687,12 @@ private:
         //TODO: This probably should be the master stream time
         auto streamSampleRange = juce::Range<int64_t>::withStartAndLength (0, inputBuffer.getNumSamples());
         juce::dsp::AudioBlock<float> outputBlock (outputBuffer);
-        processor->process ({ streamSampleRange, { outputBlock, midiOut } }, playhead, playheadOutputTime);
+        const tracktion_graph::Node::ProcessContext pc { streamSampleRange, { outputBlock, midiOut } };
+
+        if (multiThreadedProcessor != nullptr)
+            multiThreadedProcessor->process (pc, playhead, playheadOutputTime);
+        else
+            processor->process (pc, playhead, playheadOutputTime);
     }
    #endif
 };
@@ -683,9 +743,12 @@ RackType::RackType (const juce::ValueTree& v, Edit& owner)
 
     renderContextBuilder.setFunction ([this]
                                       {
-                                          std::atomic_exchange (&renderContext,
-                                                                std::make_shared<RenderContext> (*this, isExperimentalGraphProcessingEnabled()));
+                                          auto old = std::atomic_exchange (&renderContext,
+                                                                           std::make_shared<RenderContext> (*this, isExperimentalGraphProcessingEnabled()));
+                                          retireRenderContext (std::move (old));
                                       });
+
+    retiredContextCleaner.setCallback ([this] { deleteUnusedRetiredRenderContexts(); });
 }
 
 RackType::~RackType()
@@ -1808,6 +1871,32 @@ static void applyDelay (juce::AudioBuffer<float>* buffer, int start, int numSamp
     }
 }
 
+void RackType::retireRenderContext (std::shared_ptr<RenderContext> old)
+{
+    // The audio thread may still be using the old context, and if it was left to
+    // drop the last reference it would have to delete it, which could mean joining
+    // worker threads. So it's kept here until nothing else is using it.
+    if (old == nullptr)
+        return;
+
+    retiredRenderContexts.push_back (std::move (old));
+    deleteUnusedRetiredRenderContexts();
+}
+
+void RackType::deleteUnusedRetiredRenderContexts()
+{
+    TRACKTION_ASSERT_MESSAGE_THREAD
+
+    retiredRenderContexts.erase (std::remove_if (retiredRenderContexts.begin(), retiredRenderContexts.end(),
+                                                 [] (const std::shared_ptr<RenderContext>& rc) { return rc.use_count() == 1; }),
+                                 retiredRenderContexts.end());
+
+    if (retiredRenderContexts.empty())
+        retiredContextCleaner.stopTimer();
+    else if (! retiredContextCleaner.isTimerRunning())
+        retiredContextCleaner.startTimer (100);
+}
+
 bool RackType::isReadyToRender() const
 {
     auto hasRenderContext = [this] { return std::atomic_load (&renderContext); };
@@ -155,6 +155,8 @@ public:
     juce::CachedValue<juce::String> rackName;
 
     /** Enables the new tracktion_graph module for internal Rack processing.
+        Racks with parallel chains, e.g. multiband splits, share their plugins out
+        between several threads.
         N.B. This is for development only and this method will be removed in the future.
     */
     static void enableExperimentalGraphProcessing (bool);
@@ -196,6 +198,8 @@ private:
     struct RenderContext;
     std::shared_ptr<RenderContext> renderContext;
     AsyncCaller renderContextBuilder;
+    std::vector<std::shared_ptr<RenderContext>> retiredRenderContexts;
+    LambdaTimer retiredContextCleaner;
     std::atomic<int> numActiveInstances { 0 };
 
     //==============================================================================
@@ -209,6 +213,8 @@ private:
 
     void triggerUpdate();
     void updateRenderContext();
+    void retireRenderContext (std::shared_ptr<RenderContext>);
+    void deleteUnusedRetiredRenderContexts();
 
     //==============================================================================
     void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override;
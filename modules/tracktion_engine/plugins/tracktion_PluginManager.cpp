@@ -60,7 +60,8 @@ struct PluginScanMasterProcess  : private ChildProcessMaster
     }
 
     bool waitForReply (int requestID, const String& fileOrIdentifier,
-                       OwnedArray<PluginDescription>& result, KnownPluginList::CustomScanner& scanner)
+                       OwnedArray<PluginDescription>& result, KnownPluginList::CustomScanner& scanner,
+                       RelativeTime timeout)
     {
       #if ! TRACKTION_LOG_ENABLED
         juce::ignoreUnused (fileOrIdentifier);
@@ -88,6 +89,13 @@ struct PluginScanMasterProcess  : private ChildProcessMaster
                     return false;
                 }
 
+                if (elapsed > timeout)
+                {
+                    TRACKTION_LOG_ERROR ("Plugin timed out:  " + fileOrIdentifier);
+                    timedOut = true;
+                    return false;
+                }
+
                 Thread::sleep (10);
                 continue;
             }
@@ -132,6 +140,7 @@ struct PluginScanMasterProcess  : private ChildProcessMaster
     }
 
     volatile bool launched = false, crashed = false;
+    bool timedOut = false;
 
 private:
     Engine& engine;
@@ -296,64 +305,141 @@ bool PluginManager::startChildProcessPluginScan (const String& commandLine)
     return false;
 }
 
+bool PluginManager::startChildProcessPluginSandbox (const String& commandLine)
+{
+    return PluginSandbox::startChildProcess (commandLine);
+}
+
 //==============================================================================
+/** Scans each plugin file in a child process, skipping any that haven't changed since
+    they were last scanned. The directory scanner can call this from several threads
+    at once, and each thread gets a child process of its own.
+*/
 struct CustomScanner  : public KnownPluginList::CustomScanner
 {
-    CustomScanner (Engine& e) : engine (e) {}
+    CustomScanner (Engine& e, PluginScanCache& c) : engine (e), cache (c) {}
 
     bool findPluginTypesFor (AudioPluginFormat& format,
                              OwnedArray<PluginDescription>& result,
                              const String& fileOrIdentifier) override
     {
         CRASH_TRACER
+        bool scannedOK = true;
+        String hash;
 
-        if (engine.getPluginManager().usesSeparateProcessForScanning()
-             && shouldUseSeparateProcessToScan (format))
+        if (cache.findResult (format.getName(), fileOrIdentifier, result, scannedOK, hash))
         {
-            if (masterProcess != nullptr && masterProcess->crashed)
-                masterProcess = nullptr;
+            // These need to match the file so the list doesn't think they're out of date
+            for (auto desc : result)
+            {
+                desc->lastFileModTime = format.getLastModificationTime (fileOrIdentifier);
+                desc->lastInfoUpdateTime = Time::getCurrentTime();
+            }
+
+            if (! scannedOK)
+                TRACKTION_LOG ("Skipping plugin that failed to scan before:  " + fileOrIdentifier);
+
+            return scannedOK;
+        }
 
-            if (masterProcess == nullptr)
-                masterProcess = std::make_unique<PluginScanMasterProcess> (engine);
+        bool timedOut = false;
+        scannedOK = scanFile (format, result, fileOrIdentifier, timedOut);
 
-            if (masterProcess->ensureSlaveIsLaunched())
+        // A cancelled scan doesn't say anything about the plugin, and one that timed
+        // out may just have been slow this time, so neither is remembered
+        if (! (shouldExit() || timedOut))
+            cache.addResult (format.getName(), fileOrIdentifier, result, scannedOK, hash);
+
+        return scannedOK;
+    }
+
+    bool scanFile (AudioPluginFormat& format, OwnedArray<PluginDescription>& result,
+                   const String& fileOrIdentifier, bool& timedOut)
+    {
+        if (engine.getPluginManager().usesSeparateProcessForScanning()
+             && shouldUseSeparateProcessToScan (format))
+        {
+            if (auto masterProcess = takeProcess())
             {
                 auto requestID = Random().nextInt();
+                const RelativeTime timeout (engine.getEngineBehaviour().getPluginScanTimeoutSeconds());
 
                 if (! shouldExit()
                      && masterProcess->sendScanRequest (format, fileOrIdentifier, requestID)
                      && ! shouldExit())
                 {
-                    if (masterProcess->waitForReply (requestID, fileOrIdentifier, result, *this))
+                    if (masterProcess->waitForReply (requestID, fileOrIdentifier, result, *this, timeout))
+                    {
+                        returnProcess (std::move (masterProcess));
                         return true;
+                    }
 
                     // if there's a crash, give it a second chance with a fresh child process,
                     // in case the real culprit was whatever plugin preceded this one.
                     if (masterProcess->crashed && ! shouldExit())
                     {
-                        masterProcess = nullptr;
                         masterProcess = std::make_unique<PluginScanMasterProcess> (engine);
 
-                        return masterProcess->ensureSlaveIsLaunched()
-                                 && ! shouldExit()
-                                 && masterProcess->sendScanRequest (format, fileOrIdentifier, requestID)
-                                 && ! shouldExit()
-                                 && masterProcess->waitForReply (requestID, fileOrIdentifier, result, *this);
+                        if (masterProcess->ensureSlaveIsLaunched()
+                             && ! shouldExit()
+                             && masterProcess->sendScanRequest (format, fileOrIdentifier, requestID)
+                             && ! shouldExit()
+                             && masterProcess->waitForReply (requestID, fileOrIdentifier, result, *this, timeout))
+                        {
+                            returnProcess (std::move (masterProcess));
+                            return true;
+                        }
                     }
                 }
 
+                // A process that's timed out is still busy with the plugin, so it's
+                // deleted here, which kills it
+                timedOut = masterProcess->timedOut;
+                returnProcess (std::move (masterProcess));
                 return false;
             }
 
             // panic! Can't run the slave for some reason, so just do it here..
             TRACKTION_LOG_ERROR ("Falling back to scanning in main process..");
-            masterProcess.reset();
         }
 
+        // Plugins loaded in this process may not cope with being loaded from several
+        // threads at once, so only one is scanned here at a time
+        const ScopedLock sl (inProcessScanLock);
         format.findAllTypesForFile (result, fileOrIdentifier);
         return true;
     }
 
+    std::unique_ptr<PluginScanMasterProcess> takeProcess()
+    {
+        {
+            const ScopedLock sl (processLock);
+
+            if (! idleProcesses.empty())
+            {
+                auto p = std::move (idleProcesses.back());
+                idleProcesses.pop_back();
+                return p;
+            }
+        }
+
+        auto p = std::make_unique<PluginScanMasterProcess> (engine);
+
+        if (p->ensureSlaveIsLaunched())
+            return p;
+
+        return {};
+    }
+
+    void returnProcess (std::unique_ptr<PluginScanMasterProcess> p)
+    {
+        if (p != nullptr && ! p->crashed && ! p->timedOut)
+        {
+            const ScopedLock sl (processLock);
+            idleProcesses.push_back (std::move (p));
+        }
+    }
+
     static bool shouldUseSeparateProcessToScan (AudioPluginFormat& format)
     {
         auto name = format.getName();
@@ -366,14 +452,22 @@ struct CustomScanner  : public KnownPluginList::CustomScanner
     void scanFinished() override
     {
         TRACKTION_LOG ("----- Ended Plugin Scan");
-        masterProcess.reset();
+
+        {
+            const ScopedLock sl (processLock);
+            idleProcesses.clear();
+        }
+
+        cache.save();
 
         if (auto callback = engine.getPluginManager().scanCompletedCallback)
             callback();
     }
 
     Engine& engine;
-    std::unique_ptr<PluginScanMasterProcess> masterProcess;
+    PluginScanCache& cache;
+    CriticalSection processLock, inProcessScanLock;
+    std::vector<std::unique_ptr<PluginScanMasterProcess>> idleProcesses;
 };
 
 //==============================================================================
@@ -396,6 +490,10 @@ PluginManager::PluginManager (Engine& e)
 {
     createPluginInstance = [this] (const PluginDescription& description, double rate, int blockSize, String& errorMessage)
                            {
+                               if (PluginSandbox::canSandbox (description)
+                                    && (usesSandboxForPlugins() || description.pluginFormatName == PluginSandbox::getTestPluginDescription().pluginFormatName))
+                                   return getPluginSandbox().createPluginInstance (description, rate, blockSize, errorMessage);
+
                                return std::unique_ptr<AudioPluginInstance> (pluginFormatManager.createPluginInstance (description, rate, blockSize, errorMessage));
                            };
 }
@@ -430,7 +528,8 @@ void PluginManager::initialise()
 
     initialised = true;
     pluginFormatManager.addDefaultFormats();
-    knownPluginList.setCustomScanner (std::make_unique<CustomScanner> (engine));
+    scanCache = std::make_unique<PluginScanCache> (engine.getPropertyStorage().getAppCacheFolder().getChildFile ("PluginScanCache.xml"));
+    knownPluginList.setCustomScanner (std::make_unique<CustomScanner> (engine, *scanCache));
 
     auto xml = engine.getPropertyStorage().getXmlProperty (getPluginListPropertyName());
 
@@ -752,6 +851,46 @@ void PluginManager::setNumberOfThreadsForScanning (int numThreads)
     engine.getPropertyStorage().setProperty (SettingID::numThreadsForPluginScanning, jlimit (1, SystemStats::getNumCpus(), numThreads));
 }
 
+void PluginManager::scanForPlugins (std::function<bool()> shouldCancel)
+{
+    CRASH_TRACER
+    jassert (initialised); // must call PluginManager::initialise() before this!
+
+    ThreadPool pool (getNumberOfThreadsForScanning());
+
+    for (int i = 0; i < pluginFormatManager.getNumFormats(); ++i)
+    {
+        auto format = pluginFormatManager.getFormat (i);
+
+        if (! format->canScanForPlugins())
+            continue;
+
+        PluginDirectoryScanner scanner (knownPluginList, *format, format->getDefaultLocationsToSearch(),
+                                        true, {}, true);
+
+        for (int j = 0; j < pool.getNumThreads(); ++j)
+        {
+            pool.addJob ([&scanner, &shouldCancel]
+                         {
+                             String pluginBeingScanned;
+
+                             while (! (shouldCancel && shouldCancel())
+                                     && scanner.scanNextFile (true, pluginBeingScanned))
+                             {}
+                         });
+        }
+
+        while (pool.getNumJobs() > 0)
+            Thread::sleep (10);
+    }
+}
+
+PluginScanCache& PluginManager::getPluginScanCache()
+{
+    jassert (scanCache != nullptr); // must call PluginManager::initialise() before this!
+    return *scanCache;
+}
+
 bool PluginManager::usesSeparateProcessForScanning()
 {
     if (engine.getEngineBehaviour().canScanPluginsOutOfProcess())
@@ -764,6 +903,28 @@ void PluginManager::setUsesSeparateProcessForScanning (bool b)
     engine.getPropertyStorage().setProperty (SettingID::useSeparateProcessForScanning, b);
 }
 
+bool PluginManager::usesSandboxForPlugins()
+{
+    if (engine.getEngineBehaviour().canHostPluginsOutOfProcess())
+        return engine.getPropertyStorage().getProperty (SettingID::usePluginSandbox, false);
+    return false;
+}
+
+void PluginManager::setUsesSandboxForPlugins (bool b)
+{
+    engine.getPropertyStorage().setProperty (SettingID::usePluginSandbox, b);
+}
+
+PluginSandbox& PluginManager::getPluginSandbox()
+{
+    const ScopedLock sl (sandboxLock);
+
+    if (pluginSandbox == nullptr)
+        pluginSandbox = std::make_unique<PluginSandbox> (engine);
+
+    return *pluginSandbox;
+}
+
 Plugin::Ptr PluginManager::createPlugin (Edit& ed, const juce::ValueTree& v, bool isNew)
 {
     jassert (initialised); // must call PluginManager::initialise() before this!
@@ -847,6 +1008,13 @@ Plugin::Ptr PluginCache::getOrCreatePluginFor (const juce::ValueTree& v)
     if (auto f = getPluginFor (v))
         return f;
 
+    const EditLoadProfiler::ScopedEvent event (edit.getLoadProfiler(), EditLoadProfiler::pluginCategory,
+                                               [&v] (juce::String& name, juce::String& detail)
+                                               {
+                                                   name = v[IDs::type].toString();
+                                                   detail = v[IDs::name].toString();
+                                               });
+
     if (auto f = edit.engine.getPluginManager().createExistingPlugin (edit, v))
     {
         jassert (MessageManager::getInstance()->currentThreadHasLockedMessageManager()
@@ -11,6 +11,9 @@
 namespace tracktion_engine
 {
 
+class PluginSandbox;
+class PluginScanCache;
+
 class PluginManager  : private juce::ChangeListener
 {
 public:
@@ -25,6 +28,7 @@ public:
 
     //==============================================================================
     static bool startChildProcessPluginScan (const juce::String& commandLine);
+    static bool startChildProcessPluginSandbox (const juce::String& commandLine);
 
     bool areGUIsLockedByDefault();
     void setGUIsLockedByDefault (bool);
@@ -35,9 +39,29 @@ public:
     int getNumberOfThreadsForScanning();
     void setNumberOfThreadsForScanning (int);
 
+    /** Scans the default locations of all the formats for new or changed plugins and adds
+        them to the knownPluginList, scanning as many files at once as there are scanning
+        threads. Files that haven't changed since they were last scanned are taken from
+        the scan cache. This blocks until it's finished, so call it from a background thread.
+    */
+    void scanForPlugins (std::function<bool()> shouldCancel = {});
+
+    /** Returns the cache of earlier scan results. Clear this to scan every file again. */
+    PluginScanCache& getPluginScanCache();
+
     bool usesSeparateProcessForScanning();
     void setUsesSeparateProcessForScanning (bool);
 
+    /** If enabled, new instances of VST, AU and LADSPA plugins are loaded in separate
+        processes rather than in this one.
+        @see PluginSandbox, EngineBehaviour::canHostPluginsOutOfProcess
+    */
+    bool usesSandboxForPlugins();
+    void setUsesSandboxForPlugins (bool);
+
+    /** Returns the sandbox that out of process plugins are loaded in. */
+    PluginSandbox& getPluginSandbox();
+
     //==============================================================================
     Plugin::Ptr createExistingPlugin (Edit&, const juce::ValueTree&);
     Plugin::Ptr createNewPlugin (Edit&, const juce::ValueTree&);
@@ -94,6 +118,10 @@ private:
     juce::OwnedArray<BuiltInType> builtInTypes;
     bool initialised = false;
 
+    juce::CriticalSection sandboxLock;
+    std::unique_ptr<PluginSandbox> pluginSandbox;
+    std::unique_ptr<PluginScanCache> scanCache;
+
     Plugin::Ptr createPlugin (Edit&, const juce::ValueTree&, bool isNew);
 
     void changeListenerCallback (juce::ChangeBroadcaster*) override;
@@ -0,0 +1,344 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+PluginScanCache::PluginScanCache (const juce::File& cacheFile)
+    : file (cacheFile)
+{
+    load();
+}
+
+PluginScanCache::~PluginScanCache()
+{
+    save();
+}
+
+bool PluginScanCache::findResult (const juce::String& formatName, const juce::String& fileOrIdentifier,
+                                  juce::OwnedArray<juce::PluginDescription>& found, bool& scannedOK,
+                                  juce::String& hash)
+{
+    // Some formats use IDs rather than files, and there's nothing to check those against
+    if (! juce::File::isAbsolutePath (fileOrIdentifier))
+        return false;
+
+    const juce::File pluginFile (fileOrIdentifier);
+    FileInfo current;
+
+    if (! getFileInfo (pluginFile, current))
+        return false;
+
+    const auto key = getKey (formatName, fileOrIdentifier);
+    Entry cached;
+
+    {
+        const juce::ScopedLock sl (lock);
+        auto e = entries.find (key);
+
+        if (e == entries.end())
+            return false;
+
+        cached = e->second;
+    }
+
+    if (current.size != cached.info.size || current.modificationTime != cached.info.modificationTime)
+    {
+        // The hashing is done outside the lock as it can take a while for big files
+        current.hash = getHash (pluginFile);
+        hash = current.hash;
+
+        if (cached.info.hash.isEmpty() || current.hash != cached.info.hash)
+            return false;
+
+        const juce::ScopedLock sl (lock);
+        auto e = entries.find (key);
+
+        if (e != entries.end())
+        {
+            e->second.info = current;
+            needsSaving = true;
+        }
+    }
+
+    for (auto& d : cached.descriptions)
+        found.add (new juce::PluginDescription (d));
+
+    scannedOK = cached.scannedOK;
+    return true;
+}
+
+void PluginScanCache::addResult (const juce::String& formatName, const juce::String& fileOrIdentifier,
+                                 const juce::OwnedArray<juce::PluginDescription>& found, bool scannedOK,
+                                 const juce::String& hash)
+{
+    if (! juce::File::isAbsolutePath (fileOrIdentifier))
+        return;
+
+    const juce::File pluginFile (fileOrIdentifier);
+    Entry entry;
+
+    if (! getFileInfo (pluginFile, entry.info))
+        return;
+
+    entry.info.hash = hash;
+    entry.scannedOK = scannedOK;
+
+    for (auto d : found)
+        entry.descriptions.push_back (*d);
+
+    const juce::ScopedLock sl (lock);
+    entries[getKey (formatName, fileOrIdentifier)] = std::move (entry);
+    needsSaving = true;
+}
+
+void PluginScanCache::clear()
+{
+    const juce::ScopedLock sl (lock);
+    entries.clear();
+    needsSaving = true;
+}
+
+int PluginScanCache::getNumEntries() const
+{
+    const juce::ScopedLock sl (lock);
+    return (int) entries.size();
+}
+
+//==============================================================================
+bool PluginScanCache::save()
+{
+    juce::XmlElement xml ("PLUGINSCANCACHE");
+
+    {
+        const juce::ScopedLock sl (lock);
+
+        if (! needsSaving)
+            return true;
+
+        needsSaving = false;
+
+        for (auto& e : entries)
+        {
+            auto fileXml = xml.createNewChildElement ("FILE");
+            fileXml->setAttribute ("key", e.first);
+            fileXml->setAttribute ("size", juce::String (e.second.info.size));
+            fileXml->setAttribute ("time", juce::String (e.second.info.modificationTime));
+            fileXml->setAttribute ("hash", e.second.info.hash);
+            fileXml->setAttribute ("ok", e.second.scannedOK);
+
+            for (auto& d : e.second.descriptions)
+                fileXml->addChildElement (d.createXml().release());
+        }
+    }
+
+    file.getParentDirectory().createDirectory();
+
+    if (xml.writeTo (file))
+        return true;
+
+    TRACKTION_LOG_ERROR ("Couldn't save the plugin scan cache: " + file.getFullPathName());
+    return false;
+}
+
+void PluginScanCache::load()
+{
+    if (! file.existsAsFile())
+        return;
+
+    if (auto xml = std::unique_ptr<juce::XmlElement> (juce::XmlDocument::parse (file)))
+    {
+        forEachXmlChildElementWithTagName (*xml, fileXml, "FILE")
+        {
+            Entry entry;
+            entry.info.size = fileXml->getStringAttribute ("size").getLargeIntValue();
+            entry.info.modificationTime = fileXml->getStringAttribute ("time").getLargeIntValue();
+            entry.info.hash = fileXml->getStringAttribute ("hash");
+            entry.scannedOK = fileXml->getBoolAttribute ("ok", true);
+
+            forEachXmlChildElement (*fileXml, descXml)
+            {
+                juce::PluginDescription desc;
+
+                if (desc.loadFromXml (*descXml))
+                    entry.descriptions.push_back (desc);
+            }
+
+            entries[fileXml->getStringAttribute ("key")] = std::move (entry);
+        }
+    }
+}
+
+//==============================================================================
+juce::String PluginScanCache::getKey (const juce::String& formatName, const juce::String& fileOrIdentifier)
+{
+    return formatName + ":" + fileOrIdentifier;
+}
+
+bool PluginScanCache::getFileInfo (const juce::File& f, FileInfo& info)
+{
+    if (f.existsAsFile())
+    {
+        info.size = f.getSize();
+        info.modificationTime = f.getLastModificationTime().toMilliseconds();
+        return true;
+    }
+
+    if (f.isDirectory())
+    {
+        // A bundle has changed if anything inside it has
+        info.size = 0;
+        info.modificationTime = f.getLastModificationTime().toMilliseconds();
+
+        for (auto& child : f.findChildFiles (juce::File::findFiles, true))
+        {
+            info.size += child.getSize();
+            info.modificationTime = juce::jmax (info.modificationTime, child.getLastModificationTime().toMilliseconds());
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+juce::String PluginScanCache::getHash (const juce::File& f)
+{
+    if (! f.isDirectory())
+        return juce::MD5 (f).toHexString();
+
+    auto children = f.findChildFiles (juce::File::findFiles, true);
+    children.sort();
+
+    juce::MemoryOutputStream hashes;
+
+    for (auto& child : children)
+        hashes << child.getRelativePathFrom (f) << ":" << juce::MD5 (child).toHexString() << "\n";
+
+    return juce::MD5 (hashes.getData(), hashes.getDataSize()).toHexString();
+}
+
+//==============================================================================
+#if TRACKTION_UNIT_TESTS
+
+class PluginScanCacheTests   : public juce::UnitTest
+{
+public:
+    PluginScanCacheTests()
+        : juce::UnitTest ("PluginScanCache", "Tracktion") {}
+
+    //==============================================================================
+    void runTest() override
+    {
+        const juce::TemporaryFile tempDir;
+        auto dir = tempDir.getFile();
+        dir.createDirectory();
+
+        auto pluginFile = dir.getChildFile ("Test Plugin.vst3");
+        auto cacheFile = dir.getChildFile ("PluginScanCache.xml");
+        pluginFile.replaceWithText ("first version");
+
+        juce::PluginDescription desc;
+        desc.name = "Test Plugin";
+        desc.pluginFormatName = "VST3";
+        desc.fileOrIdentifier = pluginFile.getFullPathName();
+
+        juce::OwnedArray<juce::PluginDescription> scanned;
+        scanned.add (new juce::PluginDescription (desc));
+
+        const juce::String format ("VST3"), path (pluginFile.getFullPathName());
+
+        {
+            PluginScanCache cache (cacheFile);
+
+            beginTest ("Lookup");
+            {
+                juce::OwnedArray<juce::PluginDescription> found;
+                bool scannedOK = true;
+                juce::String hash;
+
+                expect (! cache.findResult (format, path, found, scannedOK, hash));
+                expect (hash.isEmpty(), "A file that's never been scanned shouldn't be hashed");
+
+                cache.addResult (format, path, scanned, true, hash);
+                expect (cache.findResult (format, path, found, scannedOK, hash));
+                expectEquals (found.size(), 1);
+                expectEquals (found.getFirst()->name, desc.name);
+                expect (scannedOK);
+                expect (! cache.findResult ("AudioUnit", path, found, scannedOK, hash));
+            }
+
+            beginTest ("Hash fallback");
+            {
+                juce::OwnedArray<juce::PluginDescription> found;
+                bool scannedOK = true;
+                juce::String hash;
+
+                // The first change has nothing to compare against, but gives a hash to store
+                touch (pluginFile);
+                expect (! cache.findResult (format, path, found, scannedOK, hash));
+                expect (hash.isNotEmpty());
+                cache.addResult (format, path, scanned, true, hash);
+
+                touch (pluginFile);
+                hash = {};
+                expect (cache.findResult (format, path, found, scannedOK, hash));
+                expectEquals (found.size(), 1);
+
+                pluginFile.appendText (" and a bit more");
+                found.clear();
+                hash = {};
+                expect (! cache.findResult (format, path, found, scannedOK, hash));
+                expect (found.isEmpty());
+                cache.addResult (format, path, {}, false, hash);
+            }
+
+            expect (cache.save());
+        }
+
+        beginTest ("Save and load");
+        {
+            PluginScanCache cache (cacheFile);
+            expectEquals (cache.getNumEntries(), 1);
+
+            juce::OwnedArray<juce::PluginDescription> found;
+            bool scannedOK = true;
+            juce::String hash;
+
+            expect (cache.findResult (format, path, found, scannedOK, hash));
+            expect (! scannedOK);
+            expect (found.isEmpty());
+
+            cache.addResult (format, path, scanned, true, hash);
+            expect (cache.save());
+
+            PluginScanCache reloaded (cacheFile);
+            found.clear();
+            expect (reloaded.findResult (format, path, found, scannedOK, hash));
+            expect (scannedOK);
+            expectEquals (found.size(), 1);
+            expectEquals (found.getFirst()->name, desc.name);
+            expectEquals (found.getFirst()->pluginFormatName, desc.pluginFormatName);
+        }
+
+        dir.deleteRecursively();
+    }
+
+    static void touch (const juce::File& f)
+    {
+        f.setLastModificationTime (f.getLastModificationTime() + juce::RelativeTime::seconds (10.0));
+    }
+};
+
+static PluginScanCacheTests pluginScanCacheTests;
+
+#endif // TRACKTION_UNIT_TESTS
+
+} // namespace tracktion_engine
@@ -0,0 +1,92 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+//==============================================================================
+/**
+    Remembers what was found in each plugin file the last time it was scanned, so
+    files that haven't changed don't have to be loaded again.
+
+    A file is looked up by its path, then checked against the size and modification
+    time it had when it was scanned. If either of those has changed, its contents are
+    hashed and the hash is stored with the new results, so after that a file that's
+    been touched or reinstalled without changing isn't scanned again. Files aren't
+    hashed when they're first scanned, as that would mean reading every plugin.
+
+    Files that crashed are remembered too, and are only retried once they change.
+    Files that timed out shouldn't be added, so they're tried again next time.
+
+    This is safe to use from several scanning threads at once.
+*/
+class PluginScanCache
+{
+public:
+    /** Loads the cache from a file, if it exists. */
+    PluginScanCache (const juce::File& cacheFile);
+    ~PluginScanCache();
+
+    /** Looks for the results of an earlier scan of a file.
+        If the file hasn't changed, this adds the plugins that were found in it to the
+        array, sets scannedOK to false if it failed to scan, and returns true.
+
+        If the file's size or modification time had changed, hash is set to the hash
+        of its contents, which should be passed to addResult if it's scanned again.
+    */
+    bool findResult (const juce::String& formatName, const juce::String& fileOrIdentifier,
+                     juce::OwnedArray<juce::PluginDescription>& found, bool& scannedOK,
+                     juce::String& hash);
+
+    /** Stores the plugins that were found in a file, or that it failed to scan.
+        The hash should be the one returned by findResult, or empty if it didn't
+        need one.
+    */
+    void addResult (const juce::String& formatName, const juce::String& fileOrIdentifier,
+                    const juce::OwnedArray<juce::PluginDescription>& found, bool scannedOK,
+                    const juce::String& hash);
+
+    /** Forgets everything, so the next scan loads every file again. */
+    void clear();
+
+    /** Writes the cache to its file if anything's changed. */
+    bool save();
+
+    /** Returns the number of files in the cache. */
+    int getNumEntries() const;
+
+private:
+    struct FileInfo
+    {
+        juce::int64 size = -1, modificationTime = 0;
+        juce::String hash;
+    };
+
+    struct Entry
+    {
+        FileInfo info;
+        bool scannedOK = true;
+        std::vector<juce::PluginDescription> descriptions;
+    };
+
+    const juce::File file;
+    std::map<juce::String, Entry> entries;
+    juce::CriticalSection lock;
+    bool needsSaving = false;
+
+    static juce::String getKey (const juce::String& formatName, const juce::String& fileOrIdentifier);
+    static bool getFileInfo (const juce::File&, FileInfo&);
+    static juce::String getHash (const juce::File&);
+    void load();
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginScanCache)
+};
+
+} // namespace tracktion_engine
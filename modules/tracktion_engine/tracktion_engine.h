@@ -304,9 +304,14 @@ namespace tracktion_engine
 #include "utilities/tracktion_CrashTracer.h"
 #include "utilities/tracktion_AsyncFunctionUtils.h"
 #include "utilities/tracktion_CpuMeasurement.h"
+#include "utilities/tracktion_AudioWorkerThreads.h"
+#include "utilities/tracktion_EditLoadProfiler.h"
 #include "utilities/tracktion_ConstrainedCachedValue.h"
 #include "utilities/tracktion_FileUtilities.h"
 #include "utilities/tracktion_AudioUtilities.h"
+#include "utilities/tracktion_BiquadCascade.h"
+#include "utilities/tracktion_IdleSuspender.h"
+#include "utilities/tracktion_LockFreeFifo.h"
 #include "utilities/tracktion_AudioScratchBuffer.h"
 #include "utilities/tracktion_AudioFadeCurve.h"
 #include "utilities/tracktion_Spline.h"
@@ -362,6 +367,7 @@ namespace tracktion_engine
 #include "plugins/tracktion_Plugin.h"
 #include "plugins/tracktion_PluginList.h"
 #include "plugins/tracktion_PluginManager.h"
+#include "plugins/tracktion_PluginScanCache.h"
 
 #include "project/tracktion_ProjectItem.h"
 #include "project/tracktion_ProjectSearchIndex.h"
@@ -378,6 +384,7 @@ namespace tracktion_engine
 
 #include "plugins/external/tracktion_VSTXML.h"
 #include "plugins/external/tracktion_ExternalPlugin.h"
+#include "plugins/external/tracktion_PluginSandbox.h"
 
 #include "plugins/internal/tracktion_VCA.h"
 #include "plugins/internal/tracktion_VolumeAndPan.h"
@@ -388,6 +395,8 @@ namespace tracktion_engine
 #include "plugins/effects/tracktion_Equaliser.h"
 
 #include "model/edit/tracktion_EditSnapshot.h"
+#include "model/edit/tracktion_EditFileFormat.h"
+#include "model/edit/tracktion_EditChunkCache.h"
 #include "model/edit/tracktion_EditFileOperations.h"
 #include "model/edit/tracktion_EditInsertPoint.h"
 #include "model/tracks/tracktion_TrackItem.h"
@@ -519,6 +528,7 @@ namespace tracktion_engine
 #include "playback/audionodes/tracktion_CombiningAudioNode.h"
 #include "playback/audionodes/tracktion_HissingAudioNode.h"
 #include "playback/audionodes/tracktion_MidiAudioNode.h"
+#include "playback/audionodes/tracktion_LoopingMidiAudioNode.h"
 #include "playback/audionodes/tracktion_MixerAudioNode.h"
 #include "playback/audionodes/tracktion_PlayHeadAudioNode.h"
 #include "playback/audionodes/tracktion_SidechainAudioNode.h"
@@ -46,7 +46,13 @@ extern "C"
  #include <cstdarg>
 #endif
 
+#if JUCE_LINUX
+ #include <fcntl.h>
+ #include <unistd.h>
+#endif
+
 #include <thread>
+#include <numeric>
 
 using namespace juce;
 
@@ -68,6 +74,7 @@ using namespace juce;
 #include "playback/audionodes/tracktion_FadeInOutAudioNode.cpp"
 #include "playback/audionodes/tracktion_HissingAudioNode.cpp"
 #include "playback/audionodes/tracktion_MidiAudioNode.cpp"
+#include "playback/audionodes/tracktion_LoopingMidiAudioNode.cpp"
 #include "playback/audionodes/tracktion_MixerAudioNode.cpp"
 #include "playback/audionodes/tracktion_PlayHeadAudioNode.cpp"
 #include "playback/audionodes/tracktion_WaveAudioNode.cpp"
@@ -83,6 +90,7 @@ using namespace juce;
 #include "playback/devices/tracktion_WaveOutputDevice.cpp"
 
 #include "playback/tracktion_HostedAudioDevice.cpp"
+#include "playback/tracktion_tests_MidiInput.cpp"
 
 static inline void sprintf (char* dest, size_t maxLength, const char* format, ...) noexcept
 {
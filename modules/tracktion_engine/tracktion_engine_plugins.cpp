@@ -22,6 +22,12 @@
 #include <atomic>
 #include <numeric>
 
+#if JUCE_LINUX
+ #include <linux/futex.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#endif
+
 #if ENABLE_EXPERIMENTAL_TRACKTION_GRAPH
  #include <tracktion_graph/tracktion_graph.h>
  
@@ -42,12 +48,15 @@ using namespace juce;
 
 #include "plugins/tracktion_Plugin.cpp"
 #include "plugins/tracktion_PluginList.cpp"
+#include "plugins/tracktion_PluginScanCache.cpp"
 #include "plugins/tracktion_PluginManager.cpp"
 #include "plugins/tracktion_PluginWindowState.cpp"
 
 #include "plugins/external/tracktion_ExternalAutomatableParameter.h"
 #include "plugins/external/tracktion_ExternalPluginBlacklist.h"
 #include "plugins/external/tracktion_ExternalPlugin.cpp"
+#include "plugins/external/tracktion_PluginSandbox.cpp"
+#include "plugins/external/tracktion_tests_PluginSandbox.cpp"
 
 #include "plugins/internal/tracktion_AuxReturn.cpp"
 #include "plugins/internal/tracktion_AuxSend.cpp"
@@ -37,6 +37,11 @@
 //==============================================================================
 #include "tracktion_engine.h"
 
+#if JUCE_LINUX
+ #include <sched.h>
+ #include <pthread.h>
+#endif
+
 //==============================================================================
 #if JUCE_MAC && TRACKTION_ENABLE_REX
 extern "C" char MacGetMacFSRefForREXDLL (FSRef* fsRef)
@@ -61,12 +66,16 @@ using namespace juce;
 
 #include "utilities/tracktion_AppFunctions.cpp"
 #include "utilities/tracktion_AudioUtilities.cpp"
+#include "utilities/tracktion_AudioWorkerThreads.cpp"
+#include "utilities/tracktion_BiquadCascade.cpp"
 #include "utilities/tracktion_ConstrainedCachedValue.cpp"
 #include "utilities/tracktion_CrashTracer.cpp"
 #include "utilities/tracktion_CurveEditor.cpp"
+#include "utilities/tracktion_EditLoadProfiler.cpp"
 #include "utilities/tracktion_ExternalPlayheadSynchroniser.cpp"
 #include "utilities/tracktion_Envelope.cpp"
 #include "utilities/tracktion_FileUtilities.cpp"
+#include "utilities/tracktion_IdleSuspender.cpp"
 #include "utilities/tracktion_Oscillators.cpp"
 #include "utilities/tracktion_PropertyStorage.cpp"
 #include "utilities/tracktion_UIBehaviour.cpp"
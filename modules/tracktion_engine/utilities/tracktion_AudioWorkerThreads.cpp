@@ -0,0 +1,133 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+void SchedulingLatency::addMeasurement (double latencyMs) noexcept
+{
+    const double lastAverage = averageMs.load (std::memory_order_relaxed);
+    averageMs.store (lastAverage + 0.1 * (latencyMs - lastAverage), std::memory_order_relaxed);
+
+    auto lastMax = maxMs.load (std::memory_order_relaxed);
+
+    while (latencyMs > lastMax && ! maxMs.compare_exchange_weak (lastMax, latencyMs, std::memory_order_relaxed))
+    {}
+}
+
+void SchedulingLatency::reset() noexcept
+{
+    averageMs.store (0.0, std::memory_order_relaxed);
+    maxMs.store (0.0, std::memory_order_relaxed);
+}
+
+//==============================================================================
+juce::Array<int> AudioWorkerThreads::getSMTSiblings (int cpu)
+{
+    juce::Array<int> siblings;
+
+   #if JUCE_LINUX
+    auto list = juce::File ("/sys/devices/system/cpu/cpu" + juce::String (cpu) + "/topology/thread_siblings_list")
+                  .loadFileAsString().trim();
+
+    // This is a list of ranges, e.g. "0,4" or "0-1"
+    for (auto& range : juce::StringArray::fromTokens (list, ",", {}))
+    {
+        auto start = range.upToFirstOccurrenceOf ("-", false, false).getIntValue();
+        auto end = range.containsChar ('-') ? range.fromFirstOccurrenceOf ("-", false, false).getIntValue()
+                                            : start;
+
+        for (int i = start; i <= end; ++i)
+            siblings.addIfNotAlreadyThere (i);
+    }
+   #endif
+
+    siblings.addIfNotAlreadyThere (cpu);
+    return siblings;
+}
+
+int AudioWorkerThreads::getCurrentCPU()
+{
+   #if JUCE_LINUX
+    return sched_getcpu();
+   #else
+    return -1;
+   #endif
+}
+
+juce::Array<int> AudioWorkerThreads::getCPUsForWorkers (const AudioWorkerThreadOptions& options)
+{
+    auto cpus = options.cpus;
+
+    if (options.deviceCallbackCPU >= 0)
+        cpus.removeValuesIn (getSMTSiblings (options.deviceCallbackCPU));
+
+    return cpus;
+}
+
+int AudioWorkerThreads::getCPUForWorker (const AudioWorkerThreadOptions& options, int workerIndex)
+{
+    auto cpus = getCPUsForWorkers (options);
+
+    if (cpus.isEmpty() || workerIndex < 0)
+        return -1;
+
+    return cpus.getUnchecked (workerIndex % cpus.size());
+}
+
+bool AudioWorkerThreads::configureCurrentThreadAsWorker (const AudioWorkerThreadOptions& options, int workerIndex)
+{
+    return configureCurrentThread (getCPUForWorker (options, workerIndex), options.realtimePriority);
+}
+
+bool AudioWorkerThreads::configureCurrentThreadAsDeviceCallback (const AudioWorkerThreadOptions& options)
+{
+    return configureCurrentThread (options.deviceCallbackCPU, options.realtimePriority);
+}
+
+bool AudioWorkerThreads::configureCurrentThread (int cpu, int realtimePriority)
+{
+    bool ok = true;
+
+   #if JUCE_LINUX
+    if (cpu >= 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO (&cpuSet);
+        CPU_SET (cpu, &cpuSet);
+
+        ok = pthread_setaffinity_np (pthread_self(), sizeof (cpuSet), &cpuSet) == 0 && ok;
+    }
+
+    if (realtimePriority > 0)
+    {
+        sched_param param;
+        param.sched_priority = juce::jlimit (sched_get_priority_min (SCHED_FIFO),
+                                             sched_get_priority_max (SCHED_FIFO),
+                                             realtimePriority);
+
+        ok = pthread_setschedparam (pthread_self(), SCHED_FIFO, &param) == 0 && ok;
+    }
+   #else
+    juce::ignoreUnused (realtimePriority);
+
+    if (cpu >= 0)
+    {
+        if (cpu < 32)
+            juce::Thread::setCurrentThreadAffinityMask ((juce::uint32) 1 << cpu);
+        else
+            ok = false;
+    }
+   #endif
+
+    return ok;
+}
+
+} // namespace tracktion_engine
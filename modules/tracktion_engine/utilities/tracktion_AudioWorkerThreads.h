@@ -0,0 +1,104 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+//==============================================================================
+/**
+    Describes how the engine's audio worker threads should be scheduled.
+    @see EngineBehaviour::getAudioWorkerThreadOptions
+*/
+struct AudioWorkerThreadOptions
+{
+    /** The CPUs worker threads can be pinned to. Each worker takes the next CPU in
+        the list, wrapping around if there are more workers than CPUs.
+        If this is empty, workers are left for the OS to schedule.
+    */
+    juce::Array<int> cpus;
+
+    /** If this is 0 or more, the audio device callback thread is pinned to this CPU
+        and neither it nor any of its SMT siblings are used for workers.
+    */
+    int deviceCallbackCPU = -1;
+
+    /** If this is greater than 0, workers and the device callback thread are switched
+        to SCHED_FIFO with this priority. This only has an effect on Linux and will
+        usually need the process to have CAP_SYS_NICE or a suitable rtprio limit.
+    */
+    int realtimePriority = 0;
+};
+
+//==============================================================================
+/**
+    Keeps a running record of how long a thread takes to start running after it's
+    been woken. This can be updated from a realtime thread.
+*/
+struct SchedulingLatency
+{
+    /** Adds a measurement in milliseconds. */
+    void addMeasurement (double latencyMs) noexcept;
+
+    /** Clears all the measurements. */
+    void reset() noexcept;
+
+    /** Returns the smoothed latency. */
+    double getAverageMs() const noexcept            { return averageMs.load (std::memory_order_relaxed); }
+
+    /** Returns the largest latency since the last reset. */
+    double getMaxMs() const noexcept                { return maxMs.load (std::memory_order_relaxed); }
+
+private:
+    std::atomic<double> averageMs { 0.0 }, maxMs { 0.0 };
+};
+
+//==============================================================================
+/**
+    Helpers to apply AudioWorkerThreadOptions to threads.
+*/
+struct AudioWorkerThreads
+{
+    /** A snapshot of a worker's scheduling. */
+    struct WorkerStats
+    {
+        int cpu = -1;                       /**< The CPU the worker was pinned to, or -1. */
+        double averageLatencyMs = 0.0;      /**< The smoothed time taken to start running after being woken. */
+        double maxLatencyMs = 0.0;          /**< The longest time taken to start running after being woken. */
+    };
+
+    /** Returns the CPUs worker threads should use, having removed the device
+        callback CPU and its SMT siblings.
+    */
+    static juce::Array<int> getCPUsForWorkers (const AudioWorkerThreadOptions&);
+
+    /** Returns the CPU a given worker should be pinned to, or -1 if it shouldn't be pinned. */
+    static int getCPUForWorker (const AudioWorkerThreadOptions&, int workerIndex);
+
+    /** Pins the calling thread to the CPU for this worker and sets its priority.
+        Returns false if any of the requested settings couldn't be applied.
+    */
+    static bool configureCurrentThreadAsWorker (const AudioWorkerThreadOptions&, int workerIndex);
+
+    /** Pins the calling thread to the device callback CPU and sets its priority.
+        Returns false if any of the requested settings couldn't be applied.
+    */
+    static bool configureCurrentThreadAsDeviceCallback (const AudioWorkerThreadOptions&);
+
+    /** Returns the CPUs that share a physical core with the given one, including itself. */
+    static juce::Array<int> getSMTSiblings (int cpu);
+
+    /** Returns the CPU the calling thread is running on, or -1 if unknown. */
+    static int getCurrentCPU();
+
+private:
+    static bool configureCurrentThread (int cpu, int realtimePriority);
+};
+
+} // namespace tracktion_engine
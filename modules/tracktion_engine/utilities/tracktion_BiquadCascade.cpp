@@ -0,0 +1,207 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+bool BiquadCascade::Coefficients::isBypass() const noexcept
+{
+    return *this == Coefficients();
+}
+
+bool BiquadCascade::Coefficients::operator== (const Coefficients& other) const noexcept
+{
+    return b0 == other.b0 && b1 == other.b1 && b2 == other.b2 && a1 == other.a1 && a2 == other.a2;
+}
+
+//==============================================================================
+BiquadCascade::BiquadCascade (int stagesToUse)
+    : numStages (stagesToUse)
+{
+    jassert (numStages > 0 && numStages <= maxNumStages);
+}
+
+void BiquadCascade::prepare (double sampleRate, int numChannelsToUse)
+{
+    numChannels = numChannelsToUse;
+    numGroups = (numChannels + (int) Lanes::size() - 1) / (int) Lanes::size();
+    state.resize ((size_t) (numGroups * maxNumStages));
+
+    // long enough to hide the steps, short enough to follow automation closely
+    rampLength = juce::jmax (chunkSize, juce::roundToInt (sampleRate * 0.005));
+
+    reset();
+}
+
+void BiquadCascade::reset()
+{
+    for (auto& s : state)
+        s = StageState();
+}
+
+void BiquadCascade::setCoefficients (int stage, const juce::IIRCoefficients& c)
+{
+    setTarget (stage, { c.coefficients[0], c.coefficients[1], c.coefficients[2],
+                        c.coefficients[3], c.coefficients[4] });
+}
+
+void BiquadCascade::setStageBypassed (int stage)
+{
+    setTarget (stage, {});
+}
+
+void BiquadCascade::setTarget (int stageIndex, Coefficients c)
+{
+    jassert (juce::isPositiveAndBelow (stageIndex, numStages));
+    auto& stage = stages[(size_t) stageIndex];
+
+    stage.target = c;
+
+    if (stage.current == c)
+    {
+        stage.rampSamplesLeft = 0;
+        return;
+    }
+
+    auto scale = 1.0f / (float) rampLength;
+    stage.step = { (c.b0 - stage.current.b0) * scale,
+                   (c.b1 - stage.current.b1) * scale,
+                   (c.b2 - stage.current.b2) * scale,
+                   (c.a1 - stage.current.a1) * scale,
+                   (c.a2 - stage.current.a2) * scale };
+    stage.rampSamplesLeft = rampLength;
+}
+
+void BiquadCascade::skipSmoothing()
+{
+    for (auto& stage : stages)
+    {
+        stage.current = stage.target;
+        stage.rampSamplesLeft = 0;
+    }
+}
+
+void BiquadCascade::advanceRamps (int numSamples)
+{
+    for (int i = 0; i < numStages; ++i)
+    {
+        auto& stage = stages[(size_t) i];
+
+        if (stage.rampSamplesLeft <= 0)
+            continue;
+
+        auto num = juce::jmin (numSamples, stage.rampSamplesLeft);
+        stage.rampSamplesLeft -= num;
+
+        if (stage.rampSamplesLeft == 0)
+        {
+            stage.current = stage.target;
+
+            // a stage that's been bypassed stops being processed, so clear out what's
+            // left in it now rather than adding it back in when it's next used
+            if (stage.current.isBypass())
+                for (int group = 0; group < numGroups; ++group)
+                    state[(size_t) (group * maxNumStages + i)] = StageState();
+        }
+        else
+        {
+            // Linear interpolation between two stable biquads stays stable as the
+            // stable region of (a1, a2) is a triangle
+            auto n = (float) num;
+            stage.current.b0 += stage.step.b0 * n;
+            stage.current.b1 += stage.step.b1 * n;
+            stage.current.b2 += stage.step.b2 * n;
+            stage.current.a1 += stage.step.a1 * n;
+            stage.current.a2 += stage.step.a2 * n;
+        }
+    }
+}
+
+void BiquadCascade::process (juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    jassert (startSample + numSamples <= buffer.getNumSamples());
+    const int numGroupsToProcess = juce::jmin (numGroups, (buffer.getNumChannels() + (int) Lanes::size() - 1) / (int) Lanes::size());
+
+    juce::ScopedNoDenormals noDenormals;
+
+    while (numSamples > 0)
+    {
+        const int num = juce::jmin ((int) chunkSize, numSamples);
+        advanceRamps (num);
+
+        int activeStages[maxNumStages];
+        int numActiveStages = 0;
+
+        for (int i = 0; i < numStages; ++i)
+            if (stages[(size_t) i].rampSamplesLeft > 0 || ! stages[(size_t) i].current.isBypass())
+                activeStages[numActiveStages++] = i;
+
+        if (numActiveStages > 0)
+            for (int group = 0; group < numGroupsToProcess; ++group)
+                processGroup (buffer, group, startSample, num, activeStages, numActiveStages);
+
+        startSample += num;
+        numSamples -= num;
+    }
+}
+
+void BiquadCascade::processGroup (juce::AudioBuffer<float>& buffer, int group, int startSample, int numSamples,
+                                  const int* activeStages, int numActiveStages) noexcept
+{
+    constexpr int numLanes = (int) Lanes::size();
+    const int firstChannel = group * numLanes;
+    const int numChannelsInGroup = juce::jmin (numLanes, juce::jmin (numChannels, buffer.getNumChannels()) - firstChannel);
+
+    Lanes frames[chunkSize];
+
+    for (int i = 0; i < numSamples; ++i)
+        frames[i] = Lanes::expand (0.0f);
+
+    for (int chan = 0; chan < numChannelsInGroup; ++chan)
+    {
+        auto src = buffer.getReadPointer (firstChannel + chan, startSample);
+
+        for (int i = 0; i < numSamples; ++i)
+            frames[i].set ((size_t) chan, src[i]);
+    }
+
+    // Transposed direct form II. The chunk stays in cache while each stage runs over it,
+    // so the channels only need to be gathered and scattered once for the whole cascade
+    auto groupState = state.data() + group * maxNumStages;
+
+    for (int k = 0; k < numActiveStages; ++k)
+    {
+        const auto& c = stages[(size_t) activeStages[k]].current;
+        auto& st = groupState[activeStages[k]];
+        auto s1 = st.s1, s2 = st.s2;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            auto in = frames[i];
+            auto out = in * c.b0 + s1;
+            s1 = in * c.b1 - out * c.a1 + s2;
+            s2 = in * c.b2 - out * c.a2;
+            frames[i] = out;
+        }
+
+        st.s1 = s1;
+        st.s2 = s2;
+    }
+
+    for (int chan = 0; chan < numChannelsInGroup; ++chan)
+    {
+        auto dest = buffer.getWritePointer (firstChannel + chan, startSample);
+
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] = frames[i].get ((size_t) chan);
+    }
+}
+
+} // namespace tracktion_engine
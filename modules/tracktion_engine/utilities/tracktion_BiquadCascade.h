@@ -0,0 +1,92 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+//==============================================================================
+/**
+    A chain of biquad filters that's applied to several channels at once.
+
+    Each channel is a lane of a SIMD register so a stereo or quad signal costs about
+    the same as a mono one, and every stage is run in a single pass over the samples.
+    All the channels share the same coefficients.
+
+    When a stage's coefficients change, they're interpolated over a few milliseconds
+    to avoid zipper noise when the parameters are automated. Stages that pass audio
+    through unchanged are skipped.
+*/
+class BiquadCascade
+{
+public:
+    /** Creates a cascade with a number of stages, all initially bypassed. */
+    explicit BiquadCascade (int numStages);
+
+    /** The largest number of stages a cascade can have. */
+    static constexpr int maxNumStages = 8;
+
+    //==============================================================================
+    /** Prepares to process a number of channels and clears the filter state. */
+    void prepare (double sampleRate, int numChannels);
+
+    /** Clears the filter state. */
+    void reset();
+
+    /** Sets the coefficients a stage should move to. */
+    void setCoefficients (int stage, const juce::IIRCoefficients&);
+
+    /** Makes a stage move towards passing audio through unchanged. */
+    void setStageBypassed (int stage);
+
+    /** Jumps straight to the target coefficients, e.g. after calling prepare(). */
+    void skipSmoothing();
+
+    /** Filters the buffer in place.
+        Any channels beyond the number passed to prepare() are left unchanged.
+    */
+    void process (juce::AudioBuffer<float>&, int startSample, int numSamples);
+
+private:
+    //==============================================================================
+    using Lanes = juce::dsp::SIMDRegister<float>;
+    static constexpr int chunkSize = 32;
+
+    struct Coefficients
+    {
+        float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+
+        bool isBypass() const noexcept;
+        bool operator== (const Coefficients&) const noexcept;
+    };
+
+    struct Stage
+    {
+        Coefficients current, target, step;
+        int rampSamplesLeft = 0;
+    };
+
+    struct StageState
+    {
+        Lanes s1 = Lanes::expand (0.0f), s2 = Lanes::expand (0.0f);
+    };
+
+    int numStages, numChannels = 0, numGroups = 0, rampLength = 256;
+    std::array<Stage, maxNumStages> stages;
+    std::vector<StageState> state;  // numGroups * maxNumStages
+
+    void setTarget (int stage, Coefficients);
+    void advanceRamps (int numSamples);
+    void processGroup (juce::AudioBuffer<float>&, int group, int startSample, int numSamples,
+                       const int* activeStages, int numActiveStages) noexcept;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BiquadCascade)
+};
+
+} // namespace tracktion_engine
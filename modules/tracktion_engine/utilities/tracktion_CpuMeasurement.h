@@ -21,7 +21,8 @@ struct ScopedCpuMeter
     ~ScopedCpuMeter() noexcept
     {
         const double msTaken = juce::Time::getMillisecondCounterHiRes() - callbackStartTime;
-        valueToUpdate.store (filterAmount * (msTaken - valueToUpdate));
+        const double lastValue = valueToUpdate.load (std::memory_order_relaxed);
+        valueToUpdate.store (lastValue + filterAmount * (msTaken - lastValue), std::memory_order_relaxed);
     }
 
 private:
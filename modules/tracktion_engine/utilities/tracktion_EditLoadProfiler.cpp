@@ -0,0 +1,170 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+EditLoadProfiler::EditLoadProfiler()
+    : startTime (Time::getMillisecondCounterHiRes())
+{
+}
+
+double EditLoadProfiler::getTimeMs() const
+{
+    return Time::getMillisecondCounterHiRes() - startTime;
+}
+
+int64 EditLoadProfiler::getNumAllocations() const
+{
+    return allocationCounter ? allocationCounter() : -1;
+}
+
+void EditLoadProfiler::addEvent (Event e)
+{
+    const ScopedLock sl (lock);
+    events.push_back (std::move (e));
+}
+
+std::vector<EditLoadProfiler::Event> EditLoadProfiler::getEvents() const
+{
+    const ScopedLock sl (lock);
+    return events;
+}
+
+void EditLoadProfiler::clear()
+{
+    const ScopedLock sl (lock);
+    events.clear();
+}
+
+//==============================================================================
+String EditLoadProfiler::toChromeTrace() const
+{
+    Array<var> traceEvents;
+    std::map<uint64, int> threadIndexes;
+
+    for (auto& e : getEvents())
+    {
+        auto threadIndex = threadIndexes.emplace (e.threadID, (int) threadIndexes.size() + 1).first->second;
+
+        DynamicObject::Ptr args = new DynamicObject();
+
+        if (e.detail.isNotEmpty())
+            args->setProperty ("detail", e.detail);
+
+        if (e.numAllocations >= 0)
+            args->setProperty ("allocations", e.numAllocations);
+
+        DynamicObject::Ptr event = new DynamicObject();
+        event->setProperty ("name", e.name);
+        event->setProperty ("cat", e.category);
+        event->setProperty ("ph", "X");
+        event->setProperty ("ts", e.startMs * 1000.0);
+        event->setProperty ("dur", e.durationMs * 1000.0);
+        event->setProperty ("pid", 1);
+        event->setProperty ("tid", threadIndex);
+        event->setProperty ("args", var (args.get()));
+
+        traceEvents.add (var (event.get()));
+    }
+
+    DynamicObject::Ptr root = new DynamicObject();
+    root->setProperty ("traceEvents", traceEvents);
+    root->setProperty ("displayTimeUnit", "ms");
+
+    return JSON::toString (var (root.get()));
+}
+
+String EditLoadProfiler::toJSONSummary() const
+{
+    struct Total
+    {
+        String category, name;
+        double totalMs = 0.0, maxMs = 0.0;
+        int64 numAllocations = 0;
+        int count = 0;
+    };
+
+    std::map<std::pair<String, String>, Total> totals;
+
+    for (auto& e : getEvents())
+    {
+        auto& t = totals[{ e.category, e.name }];
+        t.category = e.category;
+        t.name = e.name;
+        t.totalMs += e.durationMs;
+        t.maxMs = jmax (t.maxMs, e.durationMs);
+        t.numAllocations += jmax ((int64) 0, e.numAllocations);
+        ++t.count;
+    }
+
+    std::vector<Total> sorted;
+
+    for (auto& t : totals)
+        sorted.push_back (t.second);
+
+    std::stable_sort (sorted.begin(), sorted.end(),
+                      [] (const Total& a, const Total& b) { return a.totalMs > b.totalMs; });
+
+    DynamicObject::Ptr categories = new DynamicObject();
+
+    for (auto& t : sorted)
+    {
+        DynamicObject::Ptr item = new DynamicObject();
+        item->setProperty ("name", t.name);
+        item->setProperty ("count", t.count);
+        item->setProperty ("totalMs", t.totalMs);
+        item->setProperty ("maxMs", t.maxMs);
+
+        if (allocationCounter)
+            item->setProperty ("allocations", t.numAllocations);
+
+        Identifier categoryID (t.category);
+
+        if (! categories->hasProperty (categoryID))
+            categories->setProperty (categoryID, Array<var>());
+
+        if (auto list = categories->getProperty (categoryID).getArray())
+            list->add (var (item.get()));
+    }
+
+    return JSON::toString (var (categories.get()));
+}
+
+//==============================================================================
+EditLoadProfiler::ScopedEvent::ScopedEvent (EditLoadProfiler* p, const char* category,
+                                            const String& name, const String& detail)
+    : profiler (p)
+{
+    if (profiler != nullptr)
+    {
+        event.category = category;
+        event.name = name;
+        event.detail = detail;
+        event.threadID = (uint64) (pointer_sized_uint) Thread::getCurrentThreadId();
+        event.numAllocations = profiler->getNumAllocations();
+        event.startMs = profiler->getTimeMs();
+    }
+}
+
+EditLoadProfiler::ScopedEvent::~ScopedEvent()
+{
+    if (profiler != nullptr)
+    {
+        event.durationMs = profiler->getTimeMs() - event.startMs;
+
+        if (event.numAllocations >= 0)
+            event.numAllocations = profiler->getNumAllocations() - event.numAllocations;
+
+        profiler->addEvent (std::move (event));
+    }
+}
+
+} // namespace tracktion_engine
@@ -0,0 +1,114 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+//==============================================================================
+/**
+    Records how long the different stages of loading an Edit take.
+
+    Pass one of these to loadEditFromFile() or set it in Edit::Options::loadProfiler
+    and it'll be filled in with timed events for parsing the file, each of the
+    Edit's initialisation phases, each track and each plugin. You can then get the
+    results as a Chrome trace (which can be opened in chrome://tracing or Perfetto)
+    or as a JSON summary with totals per category and name.
+
+    Events can be added from any thread.
+*/
+class EditLoadProfiler
+{
+public:
+    EditLoadProfiler();
+
+    /** Event categories used by the engine. */
+    static constexpr const char* fileCategory       = "file";
+    static constexpr const char* phaseCategory      = "phase";
+    static constexpr const char* trackCategory      = "track";
+    static constexpr const char* pluginCategory     = "plugin";
+    static constexpr const char* instanceCategory   = "pluginInstance";
+
+    /** An optional function that should return a running count of allocations.
+        If this is set, each event will record how many allocations happened while it
+        was active. The engine doesn't count allocations itself so you'll need to
+        hook your own operator new or allocator to provide this. N.B. this counts
+        allocations on all threads, not just the one that recorded the event.
+    */
+    std::function<juce::int64()> allocationCounter;
+
+    //==============================================================================
+    struct Event
+    {
+        juce::String category, name, detail;
+        double startMs = 0.0, durationMs = 0.0;
+        juce::int64 numAllocations = -1;
+        juce::uint64 threadID = 0;
+    };
+
+    /** Adds a completed event. */
+    void addEvent (Event);
+
+    /** Returns all the events recorded so far. */
+    std::vector<Event> getEvents() const;
+
+    /** Removes all the events. */
+    void clear();
+
+    //==============================================================================
+    /** Returns the events in the Chrome trace event format. */
+    juce::String toChromeTrace() const;
+
+    /** Returns a JSON object with the total time, allocation count and number of
+        occurrences for each category and name, slowest first.
+    */
+    juce::String toJSONSummary() const;
+
+    //==============================================================================
+    /** Records an event for the lifetime of this object.
+        If the profiler is nullptr this does nothing so can be left in place.
+    */
+    struct ScopedEvent
+    {
+        ScopedEvent (EditLoadProfiler*, const char* category, const juce::String& name, const juce::String& detail = {});
+
+        /** Takes a function that's called as describe (name, detail) to fill in the
+            event's name and detail. It's only called if there's a profiler, so use
+            this where building the strings would cost something when not profiling.
+        */
+        template<typename DescribeFunction,
+                 typename = decltype (std::declval<DescribeFunction&>() (std::declval<juce::String&>(), std::declval<juce::String&>()))>
+        ScopedEvent (EditLoadProfiler* p, const char* category, DescribeFunction&& describe)
+            : ScopedEvent (p, category, juce::String())
+        {
+            if (profiler != nullptr)
+                describe (event.name, event.detail);
+        }
+
+        ~ScopedEvent();
+
+    private:
+        EditLoadProfiler* profiler;
+        Event event;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedEvent)
+    };
+
+private:
+    mutable juce::CriticalSection lock;
+    std::vector<Event> events;
+    const double startTime;
+
+    double getTimeMs() const;
+    juce::int64 getNumAllocations() const;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EditLoadProfiler)
+};
+
+} // namespace tracktion_engine
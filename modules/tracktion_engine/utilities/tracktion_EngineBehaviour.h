@@ -59,6 +59,27 @@ public:
       */
     virtual bool canScanPluginsOutOfProcess()                                       { return false; }
 
+    /** Should return true if your app calls PluginManager::startChildProcessPluginSandbox()
+        at startup in the same way as above, so plugins can be loaded in separate processes.
+        @see PluginManager::setUsesSandboxForPlugins
+    */
+    virtual bool canHostPluginsOutOfProcess()                                       { return false; }
+
+    /** Should return how long a plugin can take to scan before it's given up on. */
+    virtual double getPluginScanTimeoutSeconds()                                    { return 60.0; }
+
+    /** Should return the most processes to share sandboxed plugins out between. */
+    virtual int getNumberOfPluginSandboxProcesses()                                 { return juce::jlimit (1, 4, juce::SystemStats::getNumCpus() / 2); }
+
+    /** Should return true if instances of the given plugin can be created and have their
+        state restored on a background thread.
+        This is used when an Edit is loaded with Edit::Options::numPluginLoadThreads > 1.
+        By default no plugins are, as many expect to be created on the message thread.
+        Apps can opt in to the formats they've found to be safe by checking the
+        description's pluginFormatName.
+    */
+    virtual bool canInstantiatePluginOffMessageThread (const juce::PluginDescription&)     { return false; }
+
     // You may want to disable auto initialisation of the device manager if you
     // are using the engine in a plugin
     virtual bool autoInitialiseDeviceManager()                                      { return true; }
@@ -71,6 +92,13 @@ public:
     // Notifies the host application that an edit has just been saved
     virtual void editHasBeenSaved (Edit& /*edit*/, juce::File /*path*/)             {}
 
+    /** Should return true if Edits should be saved in the chunked binary format
+        rather than as XML. Binary Edits are much quicker to load but aren't
+        readable by older versions of the engine.
+        @see EditFileFormat
+    */
+    virtual bool shouldSaveEditsInBinaryFormat()                                    { return false; }
+
     //==============================================================================
     /** Should return true if the incoming timestamp for MIDI messages should be used.
         If this returns false, the current system time will be used (which could be less accurate).
@@ -84,6 +112,35 @@ public:
 
     virtual int getNumberOfCPUsToUseForAudio()                                      { return juce::jmax (1, juce::SystemStats::getNumCpus()); }
 
+    /** Should return the CPUs and priority to use for the audio worker threads and
+        the device callback thread. By default these are left to the OS.
+        This is read when the number of audio CPUs is updated and when the audio device starts.
+    */
+    virtual AudioWorkerThreadOptions getAudioWorkerThreadOptions()                  { return {}; }
+
+    /** Should return the number of threads that write recorded audio to disk. The files
+        being recorded are shared out between them, which helps when recording a lot of
+        inputs to fast drives. This is read each time recording starts.
+    */
+    virtual int getNumberOfRecordingThreads()                                       { return juce::jlimit (1, 8, juce::SystemStats::getNumCpus() / 2); }
+
+    /** Should return how many seconds of each input's audio can be waiting to be written
+        to disk. If the disk falls further behind than this, audio is dropped and replaced
+        with silence. This is read each time recording starts.
+    */
+    virtual double getRecordingBufferSeconds()                                      { return 1.0; }
+
+    /** Should return true to reserve disk space for recordings in large chunks ahead of
+        the audio being written, so files are less fragmented. This only has an effect on Linux.
+    */
+    virtual bool shouldPreallocateRecordingFiles()                                  { return false; }
+
+    /** Should return true to have recorded audio pushed to disk as it's written and then
+        dropped from the OS cache, so long recordings don't fill memory with dirty pages
+        that get flushed all at once. This only has an effect on Linux.
+    */
+    virtual bool shouldBypassCacheForRecordings()                                   { return false; }
+
     virtual bool areAudioClipsRemappedWhenTempoChanges()                            { return true; }
     virtual void setAudioClipsRemappedWhenTempoChanges (bool)                       {}
     virtual bool areAutoTempoClipsRemappedWhenTempoChanges()                        { return true; }
@@ -138,6 +195,12 @@ public:
         1: loopRangeDefinesSubsequentRepetitions    // The first section is the whole sequence, subsequent repitions are determined by the loop range.
     */
     virtual int getDefaultLoopedSequenceType()                                      { return 0; }
+
+    /** Should return the number of seconds of each SamplerPlugin sound to load into memory.
+        Sounds longer than this will have only their start loaded and the rest will be
+        streamed from the AudioFileCache as they play. Return 0 to load sounds completely.
+    */
+    virtual double getSamplerPreloadSeconds()                                       { return 0.0; }
 };
 
 } // namespace tracktion_engine
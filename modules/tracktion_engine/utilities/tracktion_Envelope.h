@@ -147,14 +147,29 @@ public:
 
         auto numChannels = buffer.getNumChannels();
 
-        while (--numSamples >= 0)
+        // The idle and sustain stages are constant so can be applied in one go
+        if (currentState == State::idle || currentState == State::sustain)
         {
-            auto env = getNextSample();
+            buffer.applyGain (startSample, numSamples, (FloatType) getNextSample());
+            return;
+        }
+
+        // Otherwise fill a block of envelope values and multiply each channel by them
+        constexpr int maxBlockSize = 64;
+        FloatType gains[maxBlockSize];
+
+        while (numSamples > 0)
+        {
+            const int numThisTime = juce::jmin (numSamples, maxBlockSize);
+
+            for (int i = 0; i < numThisTime; ++i)
+                gains[i] = (FloatType) getNextSample();
 
             for (int i = 0; i < numChannels; ++i)
-                buffer.getWritePointer (i)[startSample] *= env;
+                juce::FloatVectorOperations::multiply (buffer.getWritePointer (i, startSample), gains, numThisTime);
 
-            ++startSample;
+            startSample += numThisTime;
+            numSamples -= numThisTime;
         }
     }
 
@@ -223,6 +223,7 @@ namespace IDs
     DECLARE_ID (SIDECHAINCONNECTIONS)
     DECLARE_ID (sidechainTrigger)
     DECLARE_ID (sidechainDb)
+    DECLARE_ID (lookAhead)
     DECLARE_ID (frequency)
     DECLARE_ID (mode)
     DECLARE_ID (loFreq)
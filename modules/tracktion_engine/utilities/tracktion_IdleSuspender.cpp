@@ -0,0 +1,112 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+#if TRACKTION_UNIT_TESTS
+
+class IdleSuspenderTests   : public juce::UnitTest
+{
+public:
+    IdleSuspenderTests()
+        : juce::UnitTest ("IdleSuspender", "Tracktion") {}
+
+    //==============================================================================
+    void runTest() override
+    {
+        using Action = IdleSuspender::Action;
+
+        juce::AudioBuffer<float> loud (2, blockSize), silent (2, blockSize);
+        loud.clear();
+        loud.setSample (0, 1, 0.5f);
+        silent.clear();
+
+        beginTest ("Suspends once the tail has passed");
+        {
+            IdleSuspender suspender;
+            suspender.reset (sampleRate);
+            suspender.setTailLength (0.01); // 10 samples
+
+            expect (getAction (suspender, loud) == Action::process);
+
+            // The blocks up to and including the one that passes the tail are processed
+            expect (getAction (suspender, silent) == Action::process);
+            expect (getAction (suspender, silent) == Action::process);
+            expect (getAction (suspender, silent) == Action::process);
+            expect (! suspender.isSuspended());
+
+            expect (getAction (suspender, silent) == Action::skip);
+            expect (suspender.isSuspended());
+            expect (getAction (suspender, silent) == Action::skip);
+
+            expect (getAction (suspender, loud) == Action::wakeAndProcess);
+            expect (! suspender.isSuspended());
+            expect (getAction (suspender, loud) == Action::process);
+        }
+
+        beginTest ("Input always wakes it straight away");
+        {
+            IdleSuspender suspender;
+            suspender.reset (sampleRate);
+            suspender.setTailLength (0.0);
+
+            expect (getAction (suspender, silent) == Action::process);
+            expect (getAction (suspender, silent) == Action::skip);
+
+            for (int i = 0; i < 100; ++i)
+                expect (getAction (suspender, silent) == Action::skip);
+
+            expect (getAction (suspender, loud) == Action::wakeAndProcess);
+            expect (getAction (suspender, loud) == Action::process);
+        }
+
+        beginTest ("Reset wakes it");
+        {
+            IdleSuspender suspender;
+            suspender.reset (sampleRate);
+            suspender.setTailLength (0.0);
+
+            expect (getAction (suspender, silent) == Action::process);
+            expect (getAction (suspender, silent) == Action::skip);
+
+            suspender.reset (sampleRate);
+            expect (! suspender.isSuspended());
+            expect (getAction (suspender, silent) == Action::process);
+        }
+
+        beginTest ("Infinite tails are never suspended");
+        {
+            IdleSuspender suspender;
+            suspender.reset (sampleRate);
+            suspender.setTailLength (std::numeric_limits<double>::infinity());
+
+            for (int i = 0; i < 1000; ++i)
+                expect (getAction (suspender, silent) == Action::process);
+
+            expect (! suspender.isSuspended());
+        }
+    }
+
+private:
+    static constexpr double sampleRate = 1000.0;
+    static constexpr int blockSize = 4;
+
+    static IdleSuspender::Action getAction (IdleSuspender& suspender, const juce::AudioBuffer<float>& buffer)
+    {
+        return suspender.getNextAction (buffer, buffer.getNumChannels(), 0, buffer.getNumSamples());
+    }
+};
+
+static IdleSuspenderTests idleSuspenderTests;
+
+#endif // TRACKTION_UNIT_TESTS
+
+}
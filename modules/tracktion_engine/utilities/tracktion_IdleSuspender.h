@@ -0,0 +1,124 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+//==============================================================================
+/**
+    Lets an effect stop processing once its input has been silent for longer than
+    its tail.
+
+    Call getNextAction() from the audio thread at the start of each block. Once the
+    input has been silent for the tail length it returns skip, and the effect can
+    leave the (silent) block alone. As soon as there's some input it returns
+    wakeAndProcess so the effect can clear out its old state before processing.
+
+    The effect keeps its buffers while it's suspended, so waking never has to wait
+    for anything and the output only depends on the input. That means renders come
+    out the same whether or not they're run in real time.
+*/
+class IdleSuspender
+{
+public:
+    IdleSuspender() = default;
+
+    enum class Action
+    {
+        process,            /**< Process the block as normal. */
+        wakeAndProcess,     /**< Clear any old state and process the block. */
+        skip                /**< Leave the block as it is. */
+    };
+
+    //==============================================================================
+    /** Starts off active. Call this from the effect's initialise() method. */
+    void reset (double newSampleRate) noexcept
+    {
+        sampleRate = newSampleRate;
+        numSilentSamples = 0;
+        suspended = false;
+    }
+
+    /** Sets the tail length, in seconds. If this is infinite the effect is never suspended. */
+    void setTailLength (double seconds) noexcept
+    {
+        tailSamples = seconds == std::numeric_limits<double>::infinity() ? -1
+                                                                          : (juce::int64) (seconds * sampleRate);
+    }
+
+    /** Checks the input and returns what should be done with this block. */
+    Action getNextAction (const juce::AudioBuffer<float>& buffer, int numChannels,
+                          int startSample, int numSamples) noexcept
+    {
+        bool inputSilent = true;
+
+        for (int i = juce::jmin (numChannels, buffer.getNumChannels()); --i >= 0;)
+            if (! isSilent (buffer.getReadPointer (i, startSample), numSamples))
+                inputSilent = false;
+
+        if (inputSilent)
+        {
+            if (suspended)
+                return Action::skip;
+
+            // The block that went past the tail was still processed as it may have held
+            // the last of it, so this is the first one the buffers aren't needed for
+            if (tailSamples >= 0 && numSilentSamples > tailSamples)
+            {
+                suspended = true;
+                return Action::skip;
+            }
+
+            numSilentSamples += numSamples;
+            return Action::process;
+        }
+
+        numSilentSamples = 0;
+
+        if (! suspended)
+            return Action::process;
+
+        suspended = false;
+        return Action::wakeAndProcess;
+    }
+
+    /** Returns true if the effect is idle. */
+    bool isSuspended() const noexcept               { return suspended; }
+
+    //==============================================================================
+    /** Returns true if all the samples are below about -78dB. */
+    static bool isSilent (const float* data, int num) noexcept
+    {
+        if (num <= 0)
+            return true;
+
+        if (isNotSilent (data[0]) || isNotSilent (data[num / 2]))
+            return false;
+
+        auto range = juce::FloatVectorOperations::findMinAndMax (data, num);
+
+        return ! (isNotSilent (range.getStart()) || isNotSilent (range.getEnd()));
+    }
+
+private:
+    bool suspended = false;
+    double sampleRate = 44100.0;
+    juce::int64 tailSamples = 0, numSilentSamples = 0;
+
+    static bool isNotSilent (float v) noexcept
+    {
+        const float zeroThresh = 1.0f / 8000.0f;
+        return v < -zeroThresh || v > zeroThresh;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (IdleSuspender)
+};
+
+} // namespace tracktion_engine
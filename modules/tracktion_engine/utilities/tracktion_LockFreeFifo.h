@@ -0,0 +1,113 @@
+/*
+    ,--.                     ,--.     ,--.  ,--.
+  ,-'  '-.,--.--.,--,--.,---.|  |,-.,-'  '-.`--' ,---. ,--,--,      Copyright 2018
+  '-.  .-'|  .--' ,-.  | .--'|     /'-.  .-',--.| .-. ||      \   Tracktion Software
+    |  |  |  |  \ '-'  \ `--.|  \  \  |  |  |  |' '-' '|  ||  |       Corporation
+    `---' `--'   `--`--'`---'`--'`--' `---' `--' `---' `--''--'    www.tracktion.com
+
+    Tracktion Engine uses a GPL/commercial licence - see LICENCE.md for details.
+*/
+
+namespace tracktion_engine
+{
+
+//==============================================================================
+/**
+    A fixed-size queue of objects with one thread writing and one thread reading.
+
+    All the slots are allocated up front, so neither push() nor pop() allocate
+    as long as copying a Type into an existing slot doesn't. If the queue is full
+    push() fails rather than waiting, so the writer can be a realtime thread.
+*/
+template<typename Type>
+class LockFreeFifo
+{
+public:
+    /** Creates a queue that can hold up to capacity items. */
+    explicit LockFreeFifo (int capacity)
+        : fifo (capacity + 1), items ((size_t) (capacity + 1))
+    {
+    }
+
+    /** Returns the number of items that can be pushed before the queue is full. */
+    int getFreeSpace() const noexcept       { return fifo.getFreeSpace(); }
+
+    /** Returns the number of items waiting to be read. */
+    int getNumReady() const noexcept        { return fifo.getNumReady(); }
+
+    //==============================================================================
+    /** Adds an item to the back of the queue. This must only be called by the writer.
+        Returns false if the queue was full and the item was dropped.
+    */
+    template<typename ItemType>
+    bool push (ItemType&& item)
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite (1, start1, size1, start2, size2);
+
+        if (size1 + size2 == 0)
+            return false;
+
+        items[(size_t) (size1 > 0 ? start1 : start2)] = std::forward<ItemType> (item);
+        fifo.finishedWrite (1);
+        return true;
+    }
+
+    /** Returns the item at the front of the queue without removing it, or nullptr
+        if the queue is empty. This must only be called by the reader.
+    */
+    Type* peek() noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead (1, start1, size1, start2, size2);
+
+        if (size1 + size2 == 0)
+            return nullptr;
+
+        return &items[(size_t) (size1 > 0 ? start1 : start2)];
+    }
+
+    /** Moves the item at the front of the queue into dest and removes it.
+        This must only be called by the reader. Returns false if the queue was empty.
+    */
+    bool pop (Type& dest)
+    {
+        if (auto item = peek())
+        {
+            dest = std::move (*item);
+            fifo.finishedRead (1);
+            return true;
+        }
+
+        return false;
+    }
+
+    /** Removes the item at the front of the queue, if there is one.
+        This must only be called by the reader.
+    */
+    void skip() noexcept
+    {
+        if (fifo.getNumReady() > 0)
+            fifo.finishedRead (1);
+    }
+
+    /** Removes all the items. This must only be called by the reader. */
+    void clear() noexcept
+    {
+        fifo.finishedRead (fifo.getNumReady());
+    }
+
+    /** Empties the queue when neither the reader nor the writer can be using it. */
+    void reset() noexcept
+    {
+        fifo.reset();
+    }
+
+private:
+    juce::AbstractFifo fifo;
+    std::vector<Type> items;
+
+    JUCE_DECLARE_NON_COPYABLE (LockFreeFifo)
+};
+
+} // namespace tracktion_engine
@@ -200,6 +200,8 @@ MultiVoiceOscillator::MultiVoiceOscillator (int maxVoices)
 {
     for (int i = 0; i < maxVoices * 2; i++)
         oscillators.add (new Oscillator());
+
+    setMaxBlockSize (512);
 }
 
 void MultiVoiceOscillator::start()
@@ -222,6 +224,8 @@ void MultiVoiceOscillator::setSampleRate (double sr)
 
 void MultiVoiceOscillator::setWave (Oscillator::Waves w)
 {
+    wave = w;
+
     for (auto o : oscillators)
         o->setWave (w);
 }
@@ -262,51 +266,76 @@ void MultiVoiceOscillator::setSpread (float s)
     spread = s;
 }
 
-void MultiVoiceOscillator::process (juce::AudioSampleBuffer& buffer, int startSample, int numSamples)
+void MultiVoiceOscillator::setMaxBlockSize (int numSamples)
 {
-    if (voices == 1)
-    {
-        float leftGain  = 1.0f - pan;
-        float rightGain = 1.0f + pan;
+    voiceBuffer.setSize (1, jmax (1, numSamples), false, false, true);
+}
 
-        for (int i = 0; i < 2; i++)
-        {
-            bool left = (i % 2) == 0;
-            float panGain = left ? leftGain : rightGain;
+void MultiVoiceOscillator::process (juce::AudioSampleBuffer& buffer, int startSample, int numSamples)
+{
+    const int maxChunk = voiceBuffer.getNumSamples();
 
-            float* data = buffer.getWritePointer (left ? 0 : 1, startSample);
-            float* dataPointers[] = {data};
+    while (numSamples > 0)
+    {
+        const int numThisTime = jmin (numSamples, maxChunk);
+        processChunk (buffer, startSample, numThisTime);
+        startSample += numThisTime;
+        numSamples -= numThisTime;
+    }
+}
 
-            juce::AudioSampleBuffer channelBuffer (dataPointers, 1, numSamples);
+void MultiVoiceOscillator::processChunk (juce::AudioSampleBuffer& buffer, int startSample, int numSamples)
+{
+    // The left and right oscillators for a voice are started at the same phase and
+    // play the same note so, apart from noise, their output only differs by the pan
+    // gain. Render each voice once and add it to both sides.
+    const bool renderVoicesInMono = wave != Oscillator::noise;
+    jassert (numSamples <= voiceBuffer.getNumSamples());
 
-            oscillators[i]->setGain (gain * panGain / voices);
-            oscillators[i]->setNote (note);
-            oscillators[i]->process (channelBuffer, 0, numSamples);
-        }
-    }
-    else
+    for (int voiceIndex = 0; voiceIndex < voices; ++voiceIndex)
     {
-        for (int i = 0; i < voices * 2; i++)
+        float localPan = pan;
+        float voiceNote = note;
+
+        if (voices > 1)
         {
-            int voiceIndex = (i / 2);
-            float localPan = jlimit (-1.0f, 1.0f, ((voiceIndex % 2 == 0) ? 1 : -1) * spread);
+            localPan = jlimit (-1.0f, 1.0f, ((voiceIndex % 2 == 0) ? 1 : -1) * spread);
+            voiceNote = (note - detune / 2) + detune / (voices - 1) * voiceIndex;
+        }
 
-            float leftGain  = 1.0f - localPan;
-            float rightGain = 1.0f + localPan;
+        const float leftGain  = gain * (1.0f - localPan) / voices;
+        const float rightGain = gain * (1.0f + localPan) / voices;
 
-            float base = note - detune / 2;
-            float delta = detune / (voices - 1);
-            bool left = (i % 2) == 0;
-            float panGain = left ? leftGain : rightGain;
+        if (renderVoicesInMono)
+        {
+            voiceBuffer.clear (0, numSamples);
 
-            float* data = buffer.getWritePointer (left ? 0 : 1, startSample);
-            float* dataPointers[] = {data};
+            auto& osc = *oscillators.getUnchecked (voiceIndex * 2);
+            osc.setGain (1.0f);
+            osc.setNote (voiceNote);
+            osc.process (voiceBuffer, 0, numSamples);
 
-            juce::AudioSampleBuffer channelBuffer (dataPointers, 1, numSamples);
+            // Keep the right oscillator's settings in step in case the wave changes to noise
+            oscillators.getUnchecked (voiceIndex * 2 + 1)->setNote (voiceNote);
 
-            oscillators[i]->setGain (gain * panGain / voices);
-            oscillators[i]->setNote (base + delta * (i / 2));
-            oscillators[i]->process (channelBuffer, 0, numSamples);
+            auto voiceData = voiceBuffer.getReadPointer (0);
+            FloatVectorOperations::addWithMultiply (buffer.getWritePointer (0, startSample), voiceData, leftGain, numSamples);
+            FloatVectorOperations::addWithMultiply (buffer.getWritePointer (1, startSample), voiceData, rightGain, numSamples);
+        }
+        else
+        {
+            for (int side = 0; side < 2; ++side)
+            {
+                float* data = buffer.getWritePointer (side, startSample);
+                float* dataPointers[] = {data};
+
+                juce::AudioSampleBuffer channelBuffer (dataPointers, 1, numSamples);
+
+                auto& osc = *oscillators.getUnchecked (voiceIndex * 2 + side);
+                osc.setGain (side == 0 ? leftGain : rightGain);
+                osc.setNote (voiceNote);
+                osc.process (channelBuffer, 0, numSamples);
+            }
         }
     }
 }
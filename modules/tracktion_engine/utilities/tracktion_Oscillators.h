@@ -100,10 +100,19 @@ public:
     void setDetune (float d);
     void setSpread (float s);
 
+    /** Sizes the scratch buffer used to render each voice. Call this before processing,
+        not on the audio thread; longer blocks are rendered in pieces of this size.
+    */
+    void setMaxBlockSize (int numSamples);
+
     void process (juce::AudioSampleBuffer& buffer, int startSample, int numSamples);
 
 private:
+    void processChunk (juce::AudioSampleBuffer& buffer, int startSample, int numSamples);
+
     juce::OwnedArray<Oscillator> oscillators;
+    juce::AudioSampleBuffer voiceBuffer;
+    Oscillator::Waves wave = Oscillator::sine;
 
     int voices = 1;
     float detune = 0, spread = 0, gain = 1.0f, note = 69.0f, pan = 0.0f;
@@ -94,6 +94,7 @@ enum class SettingID
     virtualmididevices,
     virtualmidiin,
     useSeparateProcessForScanning,
+    usePluginSandbox,
     useRealtime,
     wavein,
     waveout,
@@ -11,6 +11,13 @@
 #pragma once
 
 #include <thread>
+#include <limits>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+#include <unordered_map>
+#include <mutex>
+#include <condition_variable>
 #include <emmintrin.h>
 
 namespace tracktion_graph
@@ -18,6 +25,10 @@ namespace tracktion_graph
 
 /**
     Plays back a node with mutiple threads.
+
+    The time each Node takes to process is measured and the Nodes are handed out
+    to the threads in order of the longest chain of work that depends on them, so
+    expensive Nodes get started first rather than holding up the end of the block.
 */
 class MultiThreadedNodePlayer
 {
@@ -32,6 +43,40 @@ public:
         clearThreads();
     }
     
+    /** Sets a function to be called at the start of each worker thread, e.g. to
+        set its affinity and priority. This takes effect the next time the threads
+        are created in prepareToPlay.
+    */
+    void setThreadInitialiser (std::function<void (size_t threadIndex)> initialiser)
+    {
+        threadInitialiser = std::move (initialiser);
+    }
+
+    /** Limits the number of worker threads, not counting the thread calling process().
+        This takes effect the next time the threads are created in prepareToPlay.
+    */
+    void setMaxNumThreads (size_t newMaxNumThreads)
+    {
+        maxNumThreads = newMaxNumThreads;
+    }
+
+    /** If this is enabled, the worker threads spin for a short while between blocks
+        in case the next one is about to start, then go to sleep until it does, so idle
+        players don't use any CPU. Otherwise they spin all the time, which gives the
+        lowest latency. This takes effect the next time the threads are created in
+        prepareToPlay.
+    */
+    void setWorkersSleepBetweenBlocks (bool shouldSleep)
+    {
+        workersSleepBetweenBlocks = shouldSleep;
+    }
+
+    /** Returns the number of worker threads currently running. */
+    size_t getNumThreads() const
+    {
+        return threads.size();
+    }
+
     Node& getNode()
     {
         return *rootNode;
@@ -61,6 +106,7 @@ public:
         
         // Then find all the nodes as it might have changed after initialisation
         allNodes = tracktion_graph::getNodes (*rootNode, tracktion_graph::VertexOrdering::postordering);
+        buildSchedule();
 
         createThreads();
     }
@@ -69,6 +115,7 @@ public:
     {
         // Reset the stream range
         streamSampleRange = pc.streamSampleRange;
+        blockStartTimeMs = getTimeMs();
         
         // Prepare all the nodes to be played back
         for (auto node : allNodes)
@@ -77,6 +124,9 @@ public:
         // Then set the vector to be processed
         // Threads are always running so will process as soon numNodesLeftToProcess is non-zero
         numNodesLeftToProcess = allNodes.size();
+
+        if (numThreadsSleeping.load() > 0)
+            wakeThreads();
         
         // Try to process Nodes until they're all processed
         for (;;)
@@ -89,23 +139,83 @@ public:
         while (! rootNode->hasProcessed())
             pause();
 
+        updateProcessingOrder();
+
         auto output = rootNode->getProcessedOutput();
         pc.buffers.audio.copyFrom (output.audio);
         pc.buffers.midi.copyFrom (output.midi);
         
         return -1;
     }
+
+    /** Returns the smoothed time in milliseconds each Node has been taking to process. */
+    std::vector<std::pair<Node*, double>> getNodeCosts() const
+    {
+        std::vector<std::pair<Node*, double>> costs;
+        costs.reserve (allNodes.size());
+
+        for (size_t i = 0; i < allNodes.size(); ++i)
+            costs.emplace_back (allNodes[i], nodeCostsMs[i].load (std::memory_order_relaxed));
+
+        return costs;
+    }
+
+    /** The time taken for a worker thread that was asleep to start its first Node after
+        a block starts.
+    */
+    struct ThreadLatency
+    {
+        double averageMs = 0.0, maxMs = 0.0;
+    };
+
+    /** Returns the scheduling latency of each of the worker threads.
+        This is only measured for blocks that a worker had to be woken for, as a thread
+        that's spinning picks up the next block as soon as it starts. If the workers
+        don't sleep between blocks (see setWorkersSleepBetweenBlocks) they all report 0.
+    */
+    std::vector<ThreadLatency> getThreadLatencies() const
+    {
+        std::vector<ThreadLatency> latencies;
+
+        for (auto& stats : threadStats)
+            latencies.push_back ({ stats->averageLatencyMs.load (std::memory_order_relaxed),
+                                   stats->maxLatencyMs.load (std::memory_order_relaxed) });
+
+        return latencies;
+    }
     
 private:
     //==============================================================================
     std::unique_ptr<Node> rootNode;
     std::vector<std::thread> threads;
     std::vector<Node*> allNodes;
+
+    // These are all indexes into allNodes
+    std::vector<size_t> processingOrder;
+    std::vector<std::vector<size_t>> inputIndexes;
+    std::vector<std::atomic<double>> nodeCostsMs;
+    std::vector<double> nodeRanks;
     
     juce::Range<int64_t> streamSampleRange;
     std::atomic<bool> threadsShouldExit { false };
     std::atomic<size_t> numNodesLeftToProcess { 0 };
 
+    size_t maxNumThreads = std::numeric_limits<size_t>::max();
+    bool workersSleepBetweenBlocks = false;
+    std::atomic<int> numThreadsSleeping { 0 };
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition;
+
+    struct ThreadStats
+    {
+        std::atomic<double> averageLatencyMs { 0.0 }, maxLatencyMs { 0.0 };
+        bool wasWoken = false;
+    };
+
+    std::function<void (size_t)> threadInitialiser;
+    std::vector<std::unique_ptr<ThreadStats>> threadStats;
+    std::atomic<double> blockStartTimeMs { 0.0 };
+
     //==============================================================================
     double sampleRate = 44100.0;
     int blockSize = 512;
@@ -114,11 +224,13 @@ private:
     void clearThreads()
     {
         threadsShouldExit = true;
+        wakeThreads();
 
         for (auto& t : threads)
             t.join();
         
         threads.clear();
+        threadStats.clear();
     }
     
     void createThreads()
@@ -129,10 +241,20 @@ private:
             if (node->isReadyToProcess())
                 ++numThreadsToUse;
         
-        numThreadsToUse = std::min (numThreadsToUse, (size_t) std::thread::hardware_concurrency()) - 1;
-             
+        numThreadsToUse = std::min (numThreadsToUse, (size_t) std::thread::hardware_concurrency());
+        numThreadsToUse = std::min (numThreadsToUse > 0 ? numThreadsToUse - 1 : 0, maxNumThreads);
+        threadsShouldExit = false;
+
+        for (size_t i = 0; i < numThreadsToUse; ++i)
+            threadStats.push_back (std::make_unique<ThreadStats>());
+
         for (size_t i = 0; i < numThreadsToUse; ++i)
-            threads.emplace_back ([this] { processNextFreeNodeOrWait(); });
+            threads.emplace_back ([this, i] { processNextFreeNodeOrWait (i); });
+    }
+
+    static double getTimeMs()
+    {
+        return std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now().time_since_epoch()).count();
     }
     
     inline void pause()
@@ -147,20 +269,119 @@ private:
         _mm_pause();
     }
 
+    void wakeThreads()
+    {
+        // This doesn't take the mutex so the audio thread never waits for it. A thread that's
+        // just about to sleep can miss this, but it only sleeps for a millisecond and the
+        // thread calling process() will work through the Nodes meanwhile
+        sleepCondition.notify_all();
+    }
+
+    /** Sleeps until the next block starts, or for at most a millisecond.
+        Returns true if there are Nodes to process.
+    */
+    bool waitForNextBlock()
+    {
+        std::unique_lock<std::mutex> sl (sleepMutex);
+        ++numThreadsSleeping;
+        const bool hasWork = sleepCondition.wait_for (sl, std::chrono::milliseconds (1),
+                                                      [this] { return threadsShouldExit.load() || numNodesLeftToProcess.load() > 0; });
+        --numThreadsSleeping;
+        return hasWork && ! threadsShouldExit.load();
+    }
+
     //==============================================================================
-    void processNextFreeNodeOrWait()
+    void updateLatency (ThreadStats& stats)
     {
+        // A spinning thread's latency is just how long the block took to start,
+        // so only the first Node after being woken is measured
+        if (! stats.wasWoken)
+            return;
+
+        stats.wasWoken = false;
+        const double latencyMs = getTimeMs() - blockStartTimeMs.load (std::memory_order_relaxed);
+
+        const double lastAverage = stats.averageLatencyMs.load (std::memory_order_relaxed);
+        stats.averageLatencyMs.store (lastAverage + 0.1 * (latencyMs - lastAverage), std::memory_order_relaxed);
+
+        if (latencyMs > stats.maxLatencyMs.load (std::memory_order_relaxed))
+            stats.maxLatencyMs.store (latencyMs, std::memory_order_relaxed);
+    }
+
+    //==============================================================================
+    void buildSchedule()
+    {
+        std::unordered_map<Node*, size_t> nodeIndexes;
+
+        for (size_t i = 0; i < allNodes.size(); ++i)
+            nodeIndexes[allNodes[i]] = i;
+
+        inputIndexes.assign (allNodes.size(), {});
+
+        for (size_t i = 0; i < allNodes.size(); ++i)
+            for (auto input : allNodes[i]->getDirectInputNodes())
+                inputIndexes[i].push_back (nodeIndexes.at (input));
+
+        nodeCostsMs = std::vector<std::atomic<double>> (allNodes.size());
+        nodeRanks.assign (allNodes.size(), 0.0);
+        processingOrder.resize (allNodes.size());
+        std::iota (processingOrder.begin(), processingOrder.end(), (size_t) 0);
+    }
+
+    /** Sorts the Nodes by the total cost of the longest path from them to the root.
+        Every Node costs slightly more than nothing so a Node always ranks higher than
+        the Nodes that depend on it, which keeps the order valid for processing.
+    */
+    void updateProcessingOrder()
+    {
+        constexpr double minCostMs = 1.0e-6;
+
+        for (size_t i = 0; i < allNodes.size(); ++i)
+            nodeRanks[i] = nodeCostsMs[i].load (std::memory_order_relaxed) + minCostMs;
+
+        // allNodes is post-ordered so iterating backwards visits each Node before its inputs
+        for (size_t i = allNodes.size(); i-- > 0;)
+            for (auto input : inputIndexes[i])
+                nodeRanks[input] = std::max (nodeRanks[input],
+                                             nodeCostsMs[input].load (std::memory_order_relaxed) + minCostMs + nodeRanks[i]);
+
+        std::sort (processingOrder.begin(), processingOrder.end(),
+                   [this] (size_t a, size_t b) { return nodeRanks[a] > nodeRanks[b]; });
+    }
+
+    //==============================================================================
+    void processNextFreeNodeOrWait (size_t threadIndex)
+    {
+        if (threadInitialiser)
+            threadInitialiser (threadIndex);
+
+        auto& stats = *threadStats[threadIndex];
+        const bool shouldSleep = workersSleepBetweenBlocks;
+        constexpr int numSpinsBeforeSleeping = 2000;
+        int numSpins = 0;
+
         for (;;)
         {
             if (threadsShouldExit)
                 return;
             
-            if (! processNextFreeNode())
+            if (processNextFreeNode (&stats))
+            {
+                numSpins = 0;
+            }
+            else if (! shouldSleep || ++numSpins < numSpinsBeforeSleeping)
+            {
                 pause();
+            }
+            else
+            {
+                stats.wasWoken = waitForNextBlock();
+                numSpins = 0;
+            }
         }
     }
 
-    bool processNextFreeNode()
+    bool processNextFreeNode (ThreadStats* stats = nullptr)
     {
         size_t expectedNumNodesLeft = numNodesLeftToProcess;
         
@@ -171,7 +392,10 @@ private:
 
         if (numNodesLeftToProcess.compare_exchange_strong (expectedNumNodesLeft, nodeToReserve))
         {
-            const size_t nodeIndex = allNodes.size() - nodeToReserve - 1;
+            if (stats != nullptr)
+                updateLatency (*stats);
+
+            const size_t nodeIndex = processingOrder[allNodes.size() - nodeToReserve - 1];
             auto node = allNodes[nodeIndex];
 
             // Wait until this node is actually ready to be processed
@@ -179,7 +403,13 @@ private:
             while (! node->isReadyToProcess())
                 pause();
             
+            const auto startTime = std::chrono::steady_clock::now();
             node->process (streamSampleRange);
+            const std::chrono::duration<double, std::milli> timeTaken = std::chrono::steady_clock::now() - startTime;
+
+            auto& cost = nodeCostsMs[nodeIndex];
+            const double lastCost = cost.load (std::memory_order_relaxed);
+            cost.store (lastCost + 0.2 * (timeTaken.count() - lastCost), std::memory_order_relaxed);
             
             return true;
         }